@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_CONDITION_SLOTS_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_CONDITION_SLOTS_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "work_condition.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Conditions stored in one slot per WorkCondition::Type, with a bitmask of the occupied slots.
+ *
+ * Offers the subset of the std::map interface the condition code uses, so lookups are an array index
+ * instead of a tree walk. ToMap() keeps the map form for Marshalling, json and other compatibility users.
+ */
+class ConditionSlots {
+public:
+    using Slot = std::shared_ptr<Condition>;
+    using value_type = std::pair<WorkCondition::Type, Slot>;
+    static constexpr uint32_t SLOT_COUNT = WorkCondition::Type::UNKNOWN + 1;
+
+    class const_iterator {
+    public:
+        const_iterator(const ConditionSlots *slots, uint32_t mask) : slots_(slots), mask_(mask) {}
+        value_type operator*() const
+        {
+            WorkCondition::Type type = Current();
+            return value_type(type, slots_->slots_[type]);
+        }
+        const_iterator &operator++()
+        {
+            mask_ &= mask_ - 1;
+            return *this;
+        }
+        bool operator==(const const_iterator &other) const
+        {
+            return mask_ == other.mask_;
+        }
+        bool operator!=(const const_iterator &other) const
+        {
+            return mask_ != other.mask_;
+        }
+
+    private:
+        WorkCondition::Type Current() const
+        {
+            return static_cast<WorkCondition::Type>(__builtin_ctz(mask_));
+        }
+        const ConditionSlots *slots_;
+        uint32_t mask_;
+    };
+
+    /**
+     * @brief Get the bit of a condition type.
+     *
+     * @param type The type.
+     * @return The bit, 0 if the type is out of range.
+     */
+    static uint32_t TypeBit(int32_t type)
+    {
+        return IsValidType(type) ? (1u << static_cast<uint32_t>(type)) : 0;
+    }
+
+    static bool IsValidType(int32_t type)
+    {
+        return type >= 0 && static_cast<uint32_t>(type) < SLOT_COUNT;
+    }
+
+    size_t count(WorkCondition::Type type) const
+    {
+        return (mask_ & TypeBit(type)) != 0 ? 1 : 0;
+    }
+
+    /**
+     * @brief Get the condition of a type.
+     *
+     * @param type The type.
+     * @return The condition, nullptr if the slot is empty.
+     */
+    const Slot &at(WorkCondition::Type type) const
+    {
+        return IsValidType(type) ? slots_[type] : emptySlot_;
+    }
+
+    /**
+     * @brief Insert the condition if the slot is empty, the same as std::map::emplace.
+     *
+     * @param type The type.
+     * @param condition The condition.
+     * @return True if inserted.
+     */
+    bool emplace(WorkCondition::Type type, const Slot &condition)
+    {
+        if (!IsValidType(type) || count(type) > 0) {
+            return false;
+        }
+        Set(type, condition);
+        return true;
+    }
+
+    /**
+     * @brief Insert or replace the condition of a type.
+     *
+     * @param type The type.
+     * @param condition The condition.
+     */
+    void Set(WorkCondition::Type type, const Slot &condition)
+    {
+        if (!IsValidType(type)) {
+            return;
+        }
+        slots_[type] = condition;
+        mask_ |= TypeBit(type);
+        changedMask_ |= TypeBit(type);
+    }
+
+    size_t erase(WorkCondition::Type type)
+    {
+        if (count(type) == 0) {
+            return 0;
+        }
+        slots_[type].reset();
+        mask_ &= ~TypeBit(type);
+        changedMask_ |= TypeBit(type);
+        return 1;
+    }
+
+    void clear()
+    {
+        for (auto &slot : slots_) {
+            slot.reset();
+        }
+        changedMask_ |= mask_;
+        mask_ = 0;
+    }
+
+    size_t size() const
+    {
+        return static_cast<size_t>(__builtin_popcount(mask_));
+    }
+
+    bool empty() const
+    {
+        return mask_ == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, mask_);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    /**
+     * @brief Get the bitmask of occupied slots.
+     *
+     * @return The mask, bit n is set if type n has a condition.
+     */
+    uint32_t GetMask() const
+    {
+        return mask_;
+    }
+
+    /**
+     * @brief Get and reset the bitmask of slots written since the last call.
+     *
+     * @return The mask of changed slots.
+     */
+    uint32_t TakeChangedMask()
+    {
+        uint32_t changedMask = changedMask_;
+        changedMask_ = 0;
+        return changedMask;
+    }
+
+    /**
+     * @brief Build the map view of the slots.
+     *
+     * @return The map of condition.
+     */
+    std::map<WorkCondition::Type, Slot> ToMap() const
+    {
+        std::map<WorkCondition::Type, Slot> conditionMap;
+        for (const auto &it : *this) {
+            conditionMap.emplace(it.first, it.second);
+        }
+        return conditionMap;
+    }
+
+private:
+    std::array<Slot, SLOT_COUNT> slots_ {};
+    uint32_t mask_ {0};
+    uint32_t changedMask_ {0};
+    static inline const Slot emptySlot_ {};
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_CONDITION_SLOTS_H
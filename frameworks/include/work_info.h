@@ -26,6 +26,7 @@
 #include "refbase.h"
 
 #include "work_condition.h"
+#include "work_condition_slots.h"
 #include "nlohmann/json.hpp"
 
 namespace OHOS {
@@ -250,6 +251,19 @@ public:
      * @return The map of condition.
      */
     std::shared_ptr<std::map<WorkCondition::Type, std::shared_ptr<Condition>>> GetConditionMap();
+    /**
+     * @brief Get the bitmask of required conditions.
+     *
+     * @return The mask, bit n is set if condition type n is required.
+     */
+    uint32_t GetConditionMask() const;
+    /**
+     * @brief Get the required condition of a type.
+     *
+     * @param type The type.
+     * @return The condition, nullptr if the type is not required.
+     */
+    const std::shared_ptr<Condition> &GetCondition(WorkCondition::Type type) const;
     /**
      * @brief Get extra parameters.
      *
@@ -395,7 +409,7 @@ private:
     bool persisted_;
     int32_t uid_;
     std::shared_ptr<AAFwk::WantParams> extras_;
-    std::map<WorkCondition::Type, std::shared_ptr<Condition>> conditionMap_;
+    ConditionSlots conditionMap_;
     bool callBySystemApp_ {false};
     bool preinstalled_ {false};
     std::string uriKey_;
@@ -290,7 +290,17 @@ WorkCondition::DeepIdle WorkInfo::GetDeepIdle()
 
 std::shared_ptr<std::map<WorkCondition::Type, std::shared_ptr<Condition>>> WorkInfo::GetConditionMap()
 {
-    return std::make_shared<std::map<WorkCondition::Type, std::shared_ptr<Condition>>>(conditionMap_);
+    return std::make_shared<std::map<WorkCondition::Type, std::shared_ptr<Condition>>>(conditionMap_.ToMap());
+}
+
+uint32_t WorkInfo::GetConditionMask() const
+{
+    return conditionMap_.GetMask();
+}
+
+const std::shared_ptr<Condition> &WorkInfo::GetCondition(WorkCondition::Type type) const
+{
+    return conditionMap_.at(type);
 }
 
 std::shared_ptr<AAFwk::WantParams> WorkInfo::GetExtras() const
@@ -407,7 +417,7 @@ WorkInfo* WorkInfo::Unmarshalling(Parcel &parcel)
 
 bool WorkInfo::UnmarshallCondition(Parcel &parcel, WorkInfo* read, uint32_t mapsize)
 {
-    read->conditionMap_ = std::map<WorkCondition::Type, std::shared_ptr<Condition>>();
+    read->conditionMap_ = ConditionSlots();
     for (uint32_t i = 0; i < mapsize; i++) {
         int32_t key;
         if (!parcel.ReadInt32(key)) {
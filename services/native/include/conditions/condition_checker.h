@@ -28,6 +28,7 @@ private:
     void CheckNetworkStatus();
     void CheckChargerStatus();
     void CheckBatteryStatus();
+    static int32_t QueryChargerType();
 
 private:
     std::shared_ptr<WorkQueueManager> workQueueManager_;
@@ -30,6 +30,12 @@ public:
      * @return policyResult.
      */
     int32_t GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy) override;
+    /**
+     * @brief Get how long a result of GetPolicyMaxRunning may be reused.
+     *
+     * @return The ttl in milliseconds.
+     */
+    int64_t GetSampleTtlMs() override;
 private:
     int32_t GetCpuUsage();
     std::shared_ptr<WorkPolicyManager> workPolicyManager_;
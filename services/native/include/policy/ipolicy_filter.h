@@ -29,6 +29,15 @@ public:
      * @return Res.
      */
     virtual int32_t GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy);
+    /**
+     * @brief Get how long a result of GetPolicyMaxRunning may be reused by the policy sampler.
+     *
+     * @return The ttl in milliseconds, 0 or less samples on every call.
+     */
+    virtual int64_t GetSampleTtlMs()
+    {
+        return 0;
+    }
 };
 } // namespace WorkScheduler
 } // namespace OHOS
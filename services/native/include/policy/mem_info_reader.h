@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_MEM_INFO_READER_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_MEM_INFO_READER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Reads /proc/meminfo and /proc/pressure/memory through descriptors kept open, without allocations.
+ */
+class MemInfoReader {
+public:
+    MemInfoReader();
+    ~MemInfoReader();
+    MemInfoReader(const MemInfoReader &) = delete;
+    MemInfoReader &operator=(const MemInfoReader &) = delete;
+
+    /**
+     * @brief Read MemAvailable of /proc/meminfo.
+     *
+     * @return The available memory in kB, -1 if failed.
+     */
+    int32_t ReadMemAvailable();
+    /**
+     * @brief Read the "some avg10" memory pressure of /proc/pressure/memory.
+     *
+     * @return The pressure in hundredths of a percent, -1 if failed or the kernel has no psi.
+     */
+    int32_t ReadMemPressure();
+    /**
+     * @brief Parse the MemAvailable field of a meminfo content.
+     *
+     * @param buf The nul terminated content.
+     * @return The available memory in kB, -1 if not found.
+     */
+    static int32_t ParseMemAvailable(const char *buf);
+    /**
+     * @brief Parse the "some avg10" field of a psi content.
+     *
+     * @param buf The nul terminated content.
+     * @return The pressure in hundredths of a percent, -1 if not found.
+     */
+    static int32_t ParseSomeAvg10(const char *buf);
+private:
+    static size_t ReadFile(int32_t fd, char *buf, size_t size);
+
+    int32_t memInfoFd_ = -1;
+    int32_t pressureFd_ = -1;
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_MEM_INFO_READER_H
@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "ipolicy_filter.h"
+#include "mem_info_reader.h"
 #include "work_policy_manager.h"
 
 namespace OHOS {
@@ -32,9 +33,17 @@ public:
      * @return Res.
      */
     int32_t GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy) override;
+    /**
+     * @brief Get how long a result of GetPolicyMaxRunning may be reused.
+     *
+     * @return The ttl in milliseconds.
+     */
+    int64_t GetSampleTtlMs() override;
 private:
     int32_t GetMemAvailable();
+    int32_t GetMemPressureMaxRunning();
     std::shared_ptr<WorkPolicyManager> workPolicyManager_;
+    MemInfoReader memInfoReader_;
 };
 } // namespace WorkScheduler
 } // namespace OHOS
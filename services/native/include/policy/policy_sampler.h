@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_POLICY_SAMPLER_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_POLICY_SAMPLER_H
+
+#include <atomic>
+#include <memory>
+
+#include "ffrt.h"
+#include "ipolicy_filter.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Reuses the result of a policy filter for its ttl.
+ *
+ * The first call samples the filter synchronously. Later calls return the cached result at once and refresh a
+ * stale one in the background, so dispatch decisions do not wait for the IPC behind a filter.
+ */
+class PolicySampler : public std::enable_shared_from_this<PolicySampler> {
+public:
+    explicit PolicySampler(std::shared_ptr<IPolicyFilter> filter);
+    ~PolicySampler() = default;
+    /**
+     * @brief Get policy max running, from the cache while it is valid.
+     *
+     * @param systemPolicy The system policy to fill with the sampled values.
+     * @return The max running count allowed by the filter.
+     */
+    int32_t GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy);
+    /**
+     * @brief Drop the cached result, the next call samples the filter again.
+     */
+    void Invalidate();
+
+private:
+    /**
+     * @brief Sample the filter, cached unless Invalidate ran meanwhile.
+     *
+     * @param sample The sampled values.
+     * @return The max running count allowed by the filter.
+     */
+    int32_t Sample(WorkSchedSystemPolicy &sample);
+    void RefreshAsync();
+    static void Apply(const WorkSchedSystemPolicy &sample, int32_t res, WorkSchedSystemPolicy &systemPolicy);
+
+    std::shared_ptr<IPolicyFilter> filter_;
+    ffrt::mutex mutex_;
+    bool hasSample_ {false};
+    int32_t cachedRes_ {0};
+    WorkSchedSystemPolicy cachedSample_;
+    uint64_t sampleTimeMs_ {0};
+    // bumped by Invalidate, a sample taken across it is dropped.
+    uint64_t generation_ {0};
+    std::atomic<bool> refreshing_ {false};
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_POLICY_SAMPLER_H
@@ -15,12 +15,15 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_POWER_MODE_POLICY_H
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_POWER_MODE_POLICY_H
 
+#include <atomic>
+
 #include "ipolicy_filter.h"
+#include "power_mode_callback_stub.h"
 #include "work_policy_manager.h"
 
 namespace OHOS {
 namespace WorkScheduler {
-class PowerModePolicy : public IPolicyFilter {
+class PowerModePolicy : public IPolicyFilter, public std::enable_shared_from_this<PowerModePolicy> {
 public:
     explicit PowerModePolicy(std::shared_ptr<WorkPolicyManager> workPolicyManager);
     ~PowerModePolicy() override;
@@ -30,8 +33,49 @@ public:
      * @return Res.
      */
     int32_t GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy) override;
+    /**
+     * @brief Get how long a result of GetPolicyMaxRunning may be reused.
+     *
+     * @return The ttl in milliseconds.
+     */
+    int64_t GetSampleTtlMs() override;
+    /**
+     * @brief Register the power mode callback, the pushed mode replaces polling the power manager.
+     *
+     * @return True if success,else false.
+     */
+    bool Subscribe();
+    /**
+     * @brief Unregister the power mode callback.
+     */
+    void Unsubscribe();
+    /**
+     * @brief Drop the callback of a removed power manager and fall back to polling until it is registered again.
+     */
+    void OnServiceRemoved();
+    /**
+     * @brief The OnPowerModeChanged callback, retrigger the scheduling if more works are allowed to run.
+     *
+     * @param mode The power mode.
+     */
+    void OnPowerModeChanged(PowerMgr::PowerMode mode);
 private:
+    class PowerModeCallback : public PowerMgr::PowerModeCallbackStub {
+    public:
+        explicit PowerModeCallback(std::weak_ptr<PowerModePolicy> powerModePolicy);
+        ~PowerModeCallback() override = default;
+        void OnPowerModeChanged(PowerMgr::PowerMode mode) override;
+    private:
+        std::weak_ptr<PowerModePolicy> powerModePolicy_;
+    };
+
+    bool IsCharging();
+    PowerMgr::PowerMode GetPowerMode();
+    int32_t GetPowerModeMaxRunning(PowerMgr::PowerMode mode);
     std::shared_ptr<WorkPolicyManager> workPolicyManager_;
+    std::atomic<uint32_t> powerMode_;
+    ffrt::mutex callbackMutex_;
+    sptr<PowerModeCallback> powerModeCallback_;
 };
 } // namespace WorkScheduler
 } // namespace OHOS
@@ -16,12 +16,15 @@
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_THERMAL_POLICY_H
 
 #ifdef POWERMGR_THERMAL_MANAGER_ENABLE
+#include <atomic>
+
 #include "ipolicy_filter.h"
+#include "thermal_level_callback_stub.h"
 #include "work_policy_manager.h"
 
 namespace OHOS {
 namespace WorkScheduler {
-class ThermalPolicy : public IPolicyFilter {
+class ThermalPolicy : public IPolicyFilter, public std::enable_shared_from_this<ThermalPolicy> {
 public:
     explicit ThermalPolicy(std::shared_ptr<WorkPolicyManager> workPolicyManager);
     ~ThermalPolicy() override;
@@ -31,12 +34,50 @@ public:
      * @return Res.
      */
     int32_t GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy) override;
+    /**
+     * @brief Get how long a result of GetPolicyMaxRunning may be reused.
+     *
+     * @return The ttl in milliseconds.
+     */
+    int64_t GetSampleTtlMs() override;
+    /**
+     * @brief Subscribe the thermal level callback, the pushed level replaces polling the thermal manager.
+     *
+     * @return True if success,else false.
+     */
+    bool Subscribe();
+    /**
+     * @brief Unsubscribe the thermal level callback.
+     */
+    void Unsubscribe();
+    /**
+     * @brief Drop the callback of a removed thermal manager and fall back to polling until it is subscribed again.
+     */
+    void OnServiceRemoved();
+    /**
+     * @brief The OnThermalLevelChanged callback, retrigger the scheduling if more works are allowed to run.
+     *
+     * @param thermalLevel The thermal level.
+     */
+    void OnThermalLevelChanged(int32_t thermalLevel);
 private:
+    class ThermalLevelCallback : public PowerMgr::ThermalLevelCallbackStub {
+    public:
+        explicit ThermalLevelCallback(std::weak_ptr<ThermalPolicy> thermalPolicy);
+        ~ThermalLevelCallback() override = default;
+        bool OnThermalLevelChanged(PowerMgr::ThermalLevel level) override;
+    private:
+        std::weak_ptr<ThermalPolicy> thermalPolicy_;
+    };
+
     int32_t GetThermalLevel();
     int32_t GetCurThermalLevelMaxRunning(int32_t thermalLevel);
     std::shared_ptr<WorkPolicyManager> workPolicyManager_;
     /* ordered output during map traversal */
     std::map<int32_t, int32_t> thermalLevelMap_ {};
+    std::atomic<int32_t> thermalLevel_;
+    ffrt::mutex callbackMutex_;
+    sptr<ThermalLevelCallback> thermalLevelCallback_;
 };
 } // namespace WorkScheduler
 } // namespace OHOS
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WEIGHTED_POLICY_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WEIGHTED_POLICY_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "ffrt.h"
+#include "nlohmann/json.hpp"
+#include "work_exec_history.h"
+#include "work_sched_constants.h"
+#include "work_status.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Admission by cost: every work is charged a cost while it runs, and the running works share a budget
+ * of allowRunningCount * WORK_COST_UNIT, so cheap works can run together while heavy works are throttled.
+ *
+ * Disabled by default, a disabled policy admits works by count as before.
+ */
+class WeightedPolicy {
+public:
+    struct Config {
+        bool enable {false};
+        // hard limit of running works whatever their costs are.
+        int32_t maxRunningCount {STANDBY_MAX_RUNNING_COUNT};
+        // works whose average run is shorter cost lightCost, 0 disables it.
+        uint64_t lightDurationMs {0};
+        int32_t lightCost {WORK_COST_UNIT};
+        // works whose average run is longer cost heavyCost, 0 disables it.
+        uint64_t heavyDurationMs {0};
+        int32_t heavyCost {WORK_COST_UNIT};
+        std::unordered_map<std::string, int32_t> bundleCosts;
+    };
+
+    explicit WeightedPolicy(const std::shared_ptr<WorkExecHistory> &execHistory = nullptr);
+    ~WeightedPolicy() = default;
+
+    /**
+     * @brief Update the config from the work_scheduler_weighted_policy cloud config.
+     *
+     * @param root The work_scheduler_weighted_policy object.
+     * @return True if success,else false.
+     */
+    bool UpdateConfig(const nlohmann::json &root);
+    /**
+     * @brief Whether the cost admission is enabled.
+     *
+     * @return True if enabled,else false.
+     */
+    bool IsEnabled();
+    /**
+     * @brief Get the cost of a work, from the bundle config first and then from its average run duration.
+     *
+     * @param workStatus The status of work.
+     * @return The cost in WORK_COST_UNIT per running slot.
+     */
+    int32_t GetWorkCost(const std::shared_ptr<WorkStatus> &workStatus);
+    /**
+     * @brief Whether a work can start under the policy filters' limit.
+     *
+     * @param workStatus The status of work.
+     * @param allowRunningCount The running count allowed by the policy filters.
+     * @param runningCount The count of running works.
+     * @return True if the work can start,else false.
+     */
+    bool CanRun(const std::shared_ptr<WorkStatus> &workStatus, int32_t allowRunningCount, int32_t runningCount);
+    /**
+     * @brief Dump the config.
+     *
+     * @param result The dump result.
+     */
+    void Dump(std::string &result);
+private:
+    static int32_t GetCostFromJson(const nlohmann::json &root, const std::string &key, int32_t defaultCost);
+    int32_t GetWorkCostLocked(const std::shared_ptr<WorkStatus> &workStatus);
+
+    ffrt::shared_mutex configMutex_;
+    Config config_;
+    std::shared_ptr<WorkExecHistory> execHistory_;
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WEIGHTED_POLICY_H
@@ -24,7 +24,8 @@ enum PolicyType {
     APP_ADDED,
     APP_CHANGED,
     USER_SWITCHED,
-    USER_STARTED
+    USER_STARTED,
+    USER_STOPPED
 };
 } // namespace WorkScheduler
 } // namespace OHOS
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_SYSTEM_STATE_SNAPSHOT_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_SYSTEM_STATE_SNAPSHOT_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "work_condition_slots.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Immutable values of the system conditions (network, charger, battery, storage, deep idle, standby).
+ *
+ * WorkQueueManager publishes a new snapshot for each condition event, works read the current one by reference
+ * instead of keeping their own copy of every value. A snapshot is never modified after it is published.
+ */
+class SystemStateSnapshot {
+public:
+    SystemStateSnapshot() = default;
+    /**
+     * @brief Build the next snapshot, the previous one with the value of one type replaced.
+     *
+     * @param previous The previous snapshot, nullptr for the first one.
+     * @param type The type of the changed condition.
+     * @param value The new value.
+     */
+    SystemStateSnapshot(const std::shared_ptr<const SystemStateSnapshot> &previous, WorkCondition::Type type,
+        const std::shared_ptr<Condition> &value);
+
+    /**
+     * @brief Check whether a condition type is a system state kept in the snapshot.
+     *
+     * @param type The type.
+     * @return True if the type is kept in the snapshot.
+     */
+    static bool IsSystemState(WorkCondition::Type type);
+    /**
+     * @brief Get the snapshot published last.
+     *
+     * @return The snapshot, nullptr if nothing is published yet.
+     */
+    static std::shared_ptr<const SystemStateSnapshot> GetCurrent();
+    /**
+     * @brief Publish a snapshot, readers holding the previous one keep it until they release it.
+     *
+     * @param snapshot The snapshot.
+     */
+    static void Publish(const std::shared_ptr<const SystemStateSnapshot> &snapshot);
+
+    uint64_t GetVersion() const
+    {
+        return version_;
+    }
+    /**
+     * @brief Get the value of a condition type.
+     *
+     * @param type The type.
+     * @return The value, nullptr if the type has no value yet.
+     */
+    const std::shared_ptr<Condition> &GetCondition(WorkCondition::Type type) const
+    {
+        return conditions_.at(type);
+    }
+    /**
+     * @brief Get the types changed after a version.
+     *
+     * @param version The version seen by the caller.
+     * @return The mask of the types changed after the version.
+     */
+    uint32_t GetChangedMask(uint64_t version) const;
+
+private:
+    uint64_t version_ {0};
+    // Version in which the value of type n was last changed.
+    std::array<uint64_t, ConditionSlots::SLOT_COUNT> typeVersion_ {};
+    ConditionSlots conditions_;
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_SYSTEM_STATE_SNAPSHOT_H
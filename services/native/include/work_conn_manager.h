@@ -19,6 +19,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 #include "work_scheduler_connection.h"
 #include "work_status.h"
@@ -55,15 +56,15 @@ public:
     void WriteStartWorkEvent(std::shared_ptr<WorkStatus> workStatus);
 
 private:
-    void RemoveConnInfo(const std::string &workId);
-    void AddConnInfo(const std::string &workId, sptr<WorkSchedulerConnection> &connection);
-    sptr<WorkSchedulerConnection> GetConnInfo(const std::string &workId);
+    void RemoveConnInfo(const WorkKey &workKey);
+    void AddConnInfo(const WorkKey &workKey, sptr<WorkSchedulerConnection> &connection);
+    sptr<WorkSchedulerConnection> GetConnInfo(const WorkKey &workKey);
     bool DisConnect(sptr<WorkSchedulerConnection> connect);
     sptr<OHOS::AAFwk::IAbilityManager> GetSystemAbilityManager(int32_t errCode);
 
 private:
     ffrt::mutex connMapMutex_;
-    std::map<std::string, sptr<WorkSchedulerConnection>> connMap_;
+    std::unordered_map<WorkKey, sptr<WorkSchedulerConnection>, WorkKeyHash> connMap_;
     std::map<std::string, int32_t> eventIdMap_;
 };
 } // namespace WorkScheduler
@@ -16,7 +16,14 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_DATASHARE_HELPER_H
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_DATASHARE_HELPER_H
 
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "data_ability_observer_stub.h"
 #include "datashare_helper.h"
+#include "ffrt.h"
 
 namespace OHOS {
 namespace WorkScheduler {
@@ -24,11 +31,76 @@ class WorkDatashareHelper : public NoCopyable {
 public:
     static WorkDatashareHelper& GetInstance();
     bool GetStringValue(const std::string& key, std::string& value);
+    /**
+     * @brief Get the values of several settings keys in one query.
+     *
+     * @param keys The settings keys.
+     * @param values The found values, keyed by settings key. Keys without a value are absent.
+     * @return True if the query succeeded.
+     */
+    bool GetStringValues(const std::vector<std::string>& keys, std::unordered_map<std::string, std::string>& values);
+    /**
+     * @brief Check whether a settings switch is on. The value is queried once, then kept fresh by a change
+     *        observer of the key.
+     *
+     * @param key The settings key.
+     * @return True if the value of the key is "1".
+     */
+    bool IsSwitchOn(const std::string& key);
+    /**
+     * @brief Set the callback run when the value of a cached switch changes.
+     *
+     * @param callback The callback, called with the changed key.
+     */
+    void SetSwitchChangedCallback(const std::function<void(const std::string&)>& callback);
+    /**
+     * @brief Observe and cache several settings switches with one batched query.
+     *
+     * @param keys The settings keys.
+     */
+    void PreloadSwitches(const std::vector<std::string>& keys);
+    /**
+     * @brief Drop the connection and the observers after the data share service died, the next query reconnects.
+     */
+    void OnRemoteDied();
     ~WorkDatashareHelper() override;
 
 private:
+    class SwitchObserver : public AAFwk::DataAbilityObserverStub {
+    public:
+        explicit SwitchObserver(const std::string& key) : key_(key) {}
+        ~SwitchObserver() override = default;
+        void OnChange() override;
+
+    private:
+        std::string key_;
+    };
+
+    void OnSwitchChanged(const std::string& key);
+    /**
+     * @brief Query the value of a settings key.
+     *
+     * @param key The settings key.
+     * @param value The value, set only if found.
+     * @param found Whether the key has a value.
+     * @return True if the query succeeded, whether or not the key was found.
+     */
+    bool QueryStringValue(const std::string& key, std::string& value, bool& found);
+    // takes switchMutex_ only around the observer map, never across the IPC.
+    bool ObserveSwitch(const std::string& key);
+    std::shared_ptr<DataShare::DataShareHelper> GetDataShareHelper();
     std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper();
     bool ReleaseDataShareHelper(std::shared_ptr<DataShare::DataShareHelper>& helper);
+
+    ffrt::mutex helperMutex_;
+    std::shared_ptr<DataShare::DataShareHelper> helper_;
+    ffrt::mutex switchMutex_;
+    std::unordered_map<std::string, sptr<SwitchObserver>> switchObservers_;
+    // settings key -> whether the switch is on, only keys with a registered observer are cached.
+    std::unordered_map<std::string, std::shared_ptr<std::atomic<bool>>> switchCache_;
+    std::function<void(const std::string&)> switchChangedCallback_;
+    // bumped for every change notification, a query that saw it move does not cache its value.
+    uint64_t switchChangeSeq_ {0};
 };
 } // namespace WorkScheduler
 } // namespace OHOS
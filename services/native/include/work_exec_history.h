@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_EXEC_HISTORY_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_EXEC_HISTORY_H
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "ffrt.h"
+#include "nlohmann/json.hpp"
+#include "work_key.h"
+#include "work_status.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Execution history of the works, keyed by WorkKey and bounded to the recently run works.
+ *
+ * Every stopped run updates an EWMA of the run duration and of the timeout rate, the scheduler ranks the ready
+ * works with them so short and reliable works go first when the running slots are scarce.
+ */
+class WorkExecHistory {
+public:
+    struct Record {
+        // EWMA of the run duration.
+        uint64_t durationMs {0};
+        // EWMA of the timeout rate in per mille.
+        uint32_t timeoutRate {0};
+        uint64_t lastDurationMs {0};
+        uint32_t runCount {0};
+    };
+
+    explicit WorkExecHistory(size_t capacity = DEFAULT_CAPACITY);
+    ~WorkExecHistory() = default;
+    /**
+     * @brief Record a stopped run of a work, the least recently run work is evicted when the history is full.
+     *
+     * @param workStatus The status of work.
+     * @param durationMs The duration of the run.
+     * @param isTimeOut Whether the run was stopped by the watchdog.
+     */
+    void OnWorkStop(const std::shared_ptr<WorkStatus> &workStatus, uint64_t durationMs, bool isTimeOut);
+    /**
+     * @brief Get the record of a work.
+     *
+     * @param workKey The key of work.
+     * @param record The record.
+     * @return True if the work has run before,else false.
+     */
+    bool GetRecord(const WorkKey &workKey, Record &record);
+    /**
+     * @brief Get the rank of a work among the ready works of the same priority, the lower runs first.
+     *
+     * @param workStatus The status of work.
+     * @return The expected duration weighted by the timeout rate, 0 for a work without history.
+     */
+    uint64_t GetRank(const std::shared_ptr<WorkStatus> &workStatus);
+    /**
+     * @brief Remove the records of the works of an uid.
+     *
+     * @param uid The uid of the removed app.
+     */
+    void RemoveByUid(int32_t uid);
+    /**
+     * @brief Whether the history changed since it was persisted and no persist is pending.
+     * A true result marks a persist pending until OnPersisted, so the caller posts exactly one.
+     *
+     * @param now The current time in ms.
+     * @param delayMs The delay of the persist, the rest of the persist interval.
+     * @return True if a persist should be posted,else false.
+     */
+    bool NeedPersist(uint64_t now, uint64_t &delayMs);
+    /**
+     * @brief Whether the history changed since it was persisted.
+     *
+     * @return True if changed,else false.
+     */
+    bool IsDirty();
+    /**
+     * @brief Parse the persisted history, the records are restored in their run order.
+     *
+     * @param root The persisted json.
+     * @return True if success,else false.
+     */
+    bool ParseFromJson(const nlohmann::json &root);
+    /**
+     * @brief Serialize the history.
+     *
+     * @param seq The change sequence serialized, passed back to OnPersisted.
+     * @return The json string.
+     */
+    std::string ParseToJsonStr(uint64_t &seq);
+    /**
+     * @brief Record the result of a persist, the history stays dirty if the write failed.
+     *
+     * @param seq The change sequence from ParseToJsonStr.
+     * @param isSuccess Whether the file was written.
+     * @param now The current time in ms.
+     */
+    void OnPersisted(uint64_t seq, bool isSuccess, uint64_t now);
+    /**
+     * @brief Dump the history.
+     *
+     * @param result The dump result.
+     */
+    void Dump(std::string &result);
+
+    static constexpr size_t DEFAULT_CAPACITY = 512;
+private:
+    struct Entry {
+        WorkKey workKey;
+        // only kept for the persisted json and dump.
+        std::string bundleName;
+        Record record;
+    };
+    Entry &TouchLocked(const WorkKey &workKey, const std::string &bundleName);
+
+    const size_t capacity_;
+    ffrt::mutex mutex_;
+    // most recently run first.
+    std::list<Entry> entries_;
+    std::unordered_map<WorkKey, std::list<Entry>::iterator, WorkKeyHash> index_;
+    // bumped by every change, the history is dirty while it is ahead of persistedSeq_.
+    uint64_t changeSeq_ {0};
+    uint64_t persistedSeq_ {0};
+    bool persistPending_ {false};
+    uint64_t lastPersistTime_ {0};
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_EXEC_HISTORY_H
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_KEY_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_KEY_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Identity of a work, uid and work id packed into one 64-bit value.
+ *
+ * Used as the key of every internal map so lookups never build the "u<uid>_<workId>" string,
+ * which is only kept for logging, dump and the persisted json format.
+ */
+struct WorkKey {
+    int32_t uid {0};
+    int32_t workId {0};
+
+    WorkKey() = default;
+    WorkKey(int32_t uid, int32_t workId) : uid(uid), workId(workId) {}
+
+    /**
+     * @brief Get the packed value, uid in the high 32 bits and work id in the low 32 bits.
+     *
+     * @return The packed value.
+     */
+    uint64_t Value() const
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(uid)) << 32) | static_cast<uint32_t>(workId);
+    }
+
+    /**
+     * @brief Format the key the same way as WorkStatus::MakeWorkId.
+     *
+     * @return The string form of the key.
+     */
+    std::string ToString() const
+    {
+        return std::string("u") + std::to_string(uid) + "_" + std::to_string(workId);
+    }
+
+    /**
+     * @brief Parse the string form made by ToString.
+     *
+     * @param str The string form of the key.
+     * @param key The parsed key.
+     * @return True if str is a well formed key,else false.
+     */
+    static bool FromString(const std::string &str, WorkKey &key)
+    {
+        const char *begin = str.data();
+        const char *end = begin + str.size();
+        if (begin == end || *begin != 'u') {
+            return false;
+        }
+        int32_t uid = 0;
+        auto result = std::from_chars(begin + 1, end, uid);
+        if (result.ec != std::errc() || result.ptr == end || *result.ptr != '_') {
+            return false;
+        }
+        int32_t workId = 0;
+        result = std::from_chars(result.ptr + 1, end, workId);
+        if (result.ec != std::errc() || result.ptr != end) {
+            return false;
+        }
+        key = WorkKey(uid, workId);
+        return true;
+    }
+
+    bool operator==(const WorkKey &other) const
+    {
+        return Value() == other.Value();
+    }
+
+    bool operator!=(const WorkKey &other) const
+    {
+        return Value() != other.Value();
+    }
+
+    bool operator<(const WorkKey &other) const
+    {
+        return Value() < other.Value();
+    }
+};
+
+struct WorkKeyHash {
+    size_t operator()(const WorkKey &key) const
+    {
+        return std::hash<uint64_t>()(key.Value());
+    }
+};
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_KEY_H
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_LOCK_ORDER_H
+#define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_LOCK_ORDER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace WorkScheduler {
+/**
+ * @brief Levels of the scheduler locks, a thread or ffrt task only takes a lock of a higher level than every lock
+ *        it holds.
+ *
+ * None of these locks is recursive, so taking a lock of the same level again is a violation too.
+ */
+enum class LockLevel : int32_t {
+    // WorkSchedulerService::mutex_, guards persistedMap_ and the persisted file.
+    SERVICE_PERSISTED = 1,
+    // WorkPolicyManager::ideDebugListMutex_.
+    POLICY_IDE_DEBUG,
+    // WorkPolicyManager::uidMapMutex_.
+    POLICY_UID_MAP,
+    // WorkQueueManager::mutex_.
+    QUEUE_MANAGER,
+    // WorkQueue::workListMutex_.
+    WORK_QUEUE,
+    // WorkExecHistory::mutex_, the innermost lock, read while a queue ranks its ready works.
+    WORK_EXEC_HISTORY,
+};
+
+class LockOrderChecker {
+public:
+    /**
+     * @brief Record that the calling ffrt task, or thread outside a task, is about to take a lock, reports a
+     *        violation of the hierarchy.
+     *
+     * @param level The level of the lock.
+     */
+    static void OnAcquire(LockLevel level);
+    /**
+     * @brief Record that the calling ffrt task, or thread outside a task, released a lock.
+     *
+     * @param level The level of the lock.
+     */
+    static void OnRelease(LockLevel level);
+};
+
+/**
+ * @brief Scoped lock checked against the lock hierarchy in builds with WORK_SCHED_LOCK_ORDER_CHECK.
+ */
+template<typename Mutex>
+class OrderedLockGuard {
+public:
+    OrderedLockGuard(Mutex &mutex, LockLevel level) : mutex_(mutex), level_(level)
+    {
+        LockOrderChecker::OnAcquire(level_);
+        mutex_.lock();
+    }
+    ~OrderedLockGuard()
+    {
+        mutex_.unlock();
+        LockOrderChecker::OnRelease(level_);
+    }
+    OrderedLockGuard(const OrderedLockGuard &) = delete;
+    OrderedLockGuard &operator=(const OrderedLockGuard &) = delete;
+
+private:
+    Mutex &mutex_;
+    LockLevel level_;
+};
+
+#ifndef WORK_SCHED_LOCK_ORDER_CHECK
+inline void LockOrderChecker::OnAcquire(LockLevel) {}
+
+inline void LockOrderChecker::OnRelease(LockLevel) {}
+#endif
+} // namespace WorkScheduler
+} // namespace OHOS
+#endif // FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_LOCK_ORDER_H
@@ -14,6 +14,7 @@
  */
 #ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_SCHED_SERVICES_POLICY_MANAGER_H
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_SCHED_SERVICES_POLICY_MANAGER_H
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -22,7 +23,10 @@
 #include <event_runner.h>
 #include "policy_type.h"
 #include "policy/ipolicy_filter.h"
+#include "policy/policy_sampler.h"
+#include "policy/weighted_policy.h"
 #include "work_conn_manager.h"
+#include "work_exec_history.h"
 #include "work_queue.h"
 #include "work_status.h"
 #include "ffrt.h"
@@ -55,6 +59,22 @@ public:
      * @param filter The filter.
      */
     void AddPolicyFilter(std::shared_ptr<IPolicyFilter> filter);
+    /**
+     * @brief Drop the cached results of the policy filters, they are sampled again on the next dispatch.
+     */
+    void InvalidatePolicySamples();
+    /**
+     * @brief Update the weighted policy from the cloud config.
+     *
+     * @param root The work_scheduler_weighted_policy object.
+     */
+    void UpdateWeightedPolicyConfig(const nlohmann::json &root);
+    /**
+     * @brief Get the execution history of the works.
+     *
+     * @return The execution history.
+     */
+    std::shared_ptr<WorkExecHistory> GetExecHistory();
     /**
      * @brief Add work.
      *
@@ -173,7 +193,6 @@ public:
      * @param result The result.
      */
     void Dump(std::string& result);
-    int32_t currentRunningCount = 0;
     /**
      * @brief Check work to run.
      */
@@ -318,12 +337,14 @@ private:
     void DumpUidQueueMap(std::string& result);
     void RemoveFromUidQueue(std::shared_ptr<WorkStatus> workStatus, int32_t uid);
     void RemoveFromReadyQueue(std::shared_ptr<WorkStatus> workStatus);
+    void PostRefreshExecHistory();
     void AddToReadyQueue(std::shared_ptr<std::vector<std::shared_ptr<WorkStatus>>> workStatusVector);
     void RealStartWork(std::shared_ptr<WorkStatus> workStatus);
     void RealStartSA(std::shared_ptr<WorkStatus> workStatus);
     void AddToRunningQueue(std::shared_ptr<WorkStatus> workStatus);
     void RemoveConditionUnReady();
-    std::shared_ptr<WorkStatus> GetWorkToRun();
+    std::shared_ptr<WorkStatus> GetWorkToRun(bool isSlotScarce,
+        const std::function<bool(const std::shared_ptr<WorkStatus>&)> &admit);
     void RemoveAllUnReady();
     uint32_t NewWatchdogId();
     void AddWatchdogForWork(std::shared_ptr<WorkStatus> workStatus);
@@ -344,12 +365,14 @@ private:
     std::shared_ptr<WorkConnManager> workConnManager_;
     std::shared_ptr<WorkEventHandler> handler_;
 
-    ffrt::recursive_mutex uidMapMutex_;
+    ffrt::mutex uidMapMutex_;
     std::map<int32_t, std::shared_ptr<WorkQueue>> uidQueueMap_;
 
     std::shared_ptr<WorkQueue> conditionReadyQueue_;
 
-    std::list<std::shared_ptr<IPolicyFilter>> policyFilters_;
+    std::list<std::shared_ptr<PolicySampler>> policyFilters_;
+    std::shared_ptr<WeightedPolicy> weightedPolicy_;
+    std::shared_ptr<WorkExecHistory> execHistory_;
     std::shared_ptr<AppDataClearListener> appDataClearListener_;
 
     std::shared_ptr<Watchdog> watchdog_;
@@ -364,7 +387,7 @@ private:
     int32_t dumpSetMaxRunningCount_;
     int32_t dumpSetThermalLevel_;
 
-    ffrt::recursive_mutex ideDebugListMutex_;
+    ffrt::mutex ideDebugListMutex_;
     std::list<std::shared_ptr<WorkStatus>> ideDebugList;
     std::atomic<bool> systemPolicyEventSend_ {false};
 };
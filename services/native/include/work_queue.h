@@ -15,17 +15,27 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_QUEUE_H
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_QUEUE_H
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <list>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "work_status.h"
 #include "detector_value.h"
 #include "ffrt.h"
+#include "work_lock_order.h"
 
 namespace OHOS {
 namespace WorkScheduler {
 class WorkQueue {
 public:
+    // immutable view of the works, shared by readers until the queue changes.
+    using WorkSnapshot = std::shared_ptr<const std::vector<std::shared_ptr<WorkStatus>>>;
+
     explicit WorkQueue() = default;
     ~WorkQueue() = default;
     /**
@@ -36,13 +46,25 @@ public:
      */
     std::vector<std::shared_ptr<WorkStatus>> OnConditionChanged(
         WorkCondition::Type type, std::shared_ptr<DetectorValue> conditionVal);
+    /**
+     * @brief The OnConditionChanged callback, judging only the candidate works.
+     *
+     * Running and ready works are always judged, the other works outside candidates only record the new value.
+     * The pass is O(k) in the candidates and the ready works, due repeating works are left to TIMER events.
+     *
+     * @param type The type.
+     * @param conditionVal The condition val.
+     * @param candidates The works whose condition may flip.
+     */
+    std::vector<std::shared_ptr<WorkStatus>> OnConditionChanged(WorkCondition::Type type,
+        std::shared_ptr<DetectorValue> conditionVal, const std::unordered_set<WorkKey, WorkKeyHash> &candidates);
     /**
      * @brief ParseCondition.
      *
      * @param type The type.
      * @param conditionVal The condition val.
      */
-    std::shared_ptr<Condition> ParseCondition(WorkCondition::Type type,
+    static std::shared_ptr<Condition> ParseCondition(WorkCondition::Type type,
         std::shared_ptr<DetectorValue> conditionVal);
     /**
      * @brief Push.
@@ -62,6 +84,19 @@ public:
      * @return The status of work.
      */
     std::shared_ptr<WorkStatus> GetWorkToRunByPriority();
+    /**
+     * @brief Get work to run by priority, the ready works of the lowest priority are ordered by rank.
+     *
+     * A ready work that admit rejects is passed over for the next ready one, the first ready work is returned
+     * when admit rejects them all.
+     *
+     * @param rank The rank of a work, the lower runs first. Called under the queue lock.
+     * @param admit Whether a work can start now. Called under the queue lock.
+     * @return The status of work.
+     */
+    std::shared_ptr<WorkStatus> GetWorkToRunByPriority(
+        const std::function<uint64_t(const std::shared_ptr<WorkStatus>&)> &rank,
+        const std::function<bool(const std::shared_ptr<WorkStatus>&)> &admit = nullptr);
     /**
      * @brief Remove.
      *
@@ -76,13 +111,20 @@ public:
      * @return True if success,else false.
      */
     bool Contains(std::shared_ptr<std::string> workId);
+    /**
+     * @brief Contains.
+     *
+     * @param workKey The key of work.
+     * @return True if the work is in the queue,else false.
+     */
+    bool Contains(const WorkKey &workKey);
     /**
      * @brief Find.
      *
-     * @param workId The id of work.
-     * @return The id of work.
+     * @param workKey The key of work.
+     * @return The status of work.
      */
-    std::shared_ptr<WorkStatus> Find(std::string workId);
+    std::shared_ptr<WorkStatus> Find(const WorkKey &workKey);
     /**
      * @brief Find SA.
      *
@@ -109,6 +151,21 @@ public:
      * @return The list of work.
      */
     std::list<std::shared_ptr<WorkStatus>> GetWorkList();
+    /**
+     * @brief Get a snapshot of the works, rebuilt only after the queue changed.
+     *
+     * @return The works at the time of the call, never null.
+     */
+    WorkSnapshot GetSnapshot();
+    /**
+     * @brief Visit every work of the current snapshot without taking the queue lock.
+     *
+     * Works pushed or removed during the visit are not seen, and nothing keeps other threads from changing a
+     * visited work meanwhile. Callers that need that hold their own lock, as the work list copy did before.
+     *
+     * @param visitor Called with each work.
+     */
+    void ForEach(const std::function<void(const std::shared_ptr<WorkStatus>&)> &visitor);
     /**
      * @brief Remove unready.
      */
@@ -153,19 +210,63 @@ public:
     void SetMinIntervalByDump(int64_t interval);
     bool Find(const int32_t userId, const std::string &bundleName);
 private:
-    ffrt::recursive_mutex workListMutex_;
-    std::list<std::shared_ptr<WorkStatus>> workList_;
-};
-class WorkComp {
-public:
+    struct WorkNode {
+        std::shared_ptr<WorkStatus> work;
+        int32_t priority;
+        uint64_t sequence;
+        size_t *position;
+    };
+    // read side of the queue, published atomically and replaced as a whole when the works change.
+    struct WorkView {
+        std::vector<std::shared_ptr<WorkStatus>> works;
+        std::unordered_map<WorkKey, std::shared_ptr<WorkStatus>, WorkKeyHash> index;
+    };
+    static bool NodeLess(const WorkNode &lhs, const WorkNode &rhs);
+    void PushLocked(const std::shared_ptr<WorkStatus> &workStatus);
     /**
-     * @brief operator.
+     * @brief Load the current view, building it under the queue lock only after the works changed.
      *
-     * @param w1 The w1.
-     * @param w2 The w2.
-     * @return True if success,else false.
+     * @return The current view, never null.
+     */
+    std::shared_ptr<const WorkView> LoadView();
+    void InvalidateView();
+    void SwapNode(size_t lhs, size_t rhs);
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    void EraseNode(size_t index);
+    void Heapify();
+    /**
+     * @brief Re-key every node whose work priority changed in another queue, for the walks visiting all nodes.
      */
-    bool operator () (const std::shared_ptr<WorkStatus> w1, const std::shared_ptr<WorkStatus> w2);
+    void RefreshStaleKeys();
+    size_t FindWorkToRunLocked(const std::function<uint64_t(const std::shared_ptr<WorkStatus>&)> &rank,
+        const std::function<bool(const std::shared_ptr<WorkStatus>&)> &admit);
+    /**
+     * @brief Visit the heap in priority order without reordering it.
+     *
+     * @param visitor Called with the node index, return false to stop visiting.
+     */
+    void VisitByPriority(const std::function<bool(size_t)> &visitor);
+    void CollectReadyWork(const std::shared_ptr<WorkStatus> &work, WorkCondition::Type type,
+        std::shared_ptr<Condition> value, std::vector<std::shared_ptr<WorkStatus>> &result,
+        std::set<int32_t> &uidList);
+    /**
+     * @brief Get the condition of an event, shared from the published system state when it is one.
+     *
+     * @param type The type.
+     * @param conditionVal The condition val.
+     * @return The condition.
+     */
+    static std::shared_ptr<Condition> GetEventCondition(WorkCondition::Type type,
+        const std::shared_ptr<DetectorValue> &conditionVal);
+
+    ffrt::mutex workListMutex_;
+    std::vector<WorkNode> workHeap_;
+    // workKey -> heap position, nodes keep a pointer to their slot so sifting never rehashes.
+    std::unordered_map<WorkKey, size_t, WorkKeyHash> heapIndex_;
+    uint64_t nextSequence_ {0};
+    // read with std::atomic_load, readers never wait for a condition evaluation pass.
+    std::shared_ptr<const WorkView> view_;
 };
 } // namespace WorkScheduler
 } // namespace OHOS
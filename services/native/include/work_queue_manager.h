@@ -16,9 +16,12 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_QUEUE_MANAGER_H
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_QUEUE_MANAGER_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <map>
+#include <set>
+#include <unordered_set>
 
 #include "conditions/icondition_listener.h"
 #include "work_queue.h"
@@ -76,6 +79,12 @@ public:
      */
     void OnConditionChanged(WorkCondition::Type conditionType,
         std::shared_ptr<DetectorValue> conditionVal);
+    /**
+     * @brief Judge again the preinstalled works using a settings switch, called when the switch changes.
+     *
+     * @param uriKey The settings key of the switch.
+     */
+    void OnUriKeySwitchChanged(const std::string &uriKey);
     /**
      * @brief Stop and clear works.
      *
@@ -117,20 +126,65 @@ public:
      * @brief Set min interval by dump.
      */
     void SetMinIntervalByDump(int64_t interval);
+    /**
+     * @brief Set the window in which the events following a judged event of a state condition type are merged
+     *        into one evaluation at the end of the window.
+     *
+     * @param windowMs The window in milliseconds, 0 or less evaluates every event.
+     */
+    void SetCoalesceWindow(int64_t windowMs);
 private:
+    void HandleConditionChanged(WorkCondition::Type conditionType, std::shared_ptr<DetectorValue> conditionVal);
+    void PostCoalesceWindowEnd(WorkCondition::Type conditionType, int64_t windowMs);
+    static bool IsCoalescedType(WorkCondition::Type conditionType);
     std::vector<std::shared_ptr<WorkStatus>> GetReayQueue(WorkCondition::Type conditionType,
         std::shared_ptr<DetectorValue> conditionVal);
-    void PushWork(std::vector<std::shared_ptr<WorkStatus>> &works, std::vector<std::shared_ptr<WorkStatus>> &result);
     void PrintWorkStatus(WorkCondition::Type conditionType);
     void PrintAllWorkStatus(WorkCondition::Type conditionType);
     void ClearTimeOutWorkStatus();
     void AsyncStopWork(std::shared_ptr<WorkStatus> workStatus);
+    void AddToConditionIndex(WorkCondition::Type type, const std::shared_ptr<WorkStatus> &workStatus);
+    void RemoveFromConditionIndex(WorkCondition::Type type, const std::shared_ptr<WorkStatus> &workStatus);
+    std::vector<std::shared_ptr<WorkStatus>> GetReadyWorksByUriKey(const std::string &uriKey);
+    void PublishSystemState(WorkCondition::Type type, const std::shared_ptr<DetectorValue> &conditionVal);
+    /**
+     * @brief Get the works whose condition may flip from the last value to the new one.
+     *
+     * @param type The condition type.
+     * @param conditionVal The new condition val.
+     * @param candidates The works to judge.
+     * @return True if candidates is valid, false if every work of the queue should be judged.
+     */
+    bool GetConditionCandidates(WorkCondition::Type type, const std::shared_ptr<DetectorValue> &conditionVal,
+        std::unordered_set<WorkKey, WorkKeyHash> &candidates);
+    void CollectBucketWorks(const std::set<int32_t> &lastBuckets, const std::set<int32_t> &newBuckets,
+        const std::map<int32_t, std::unordered_set<WorkKey, WorkKeyHash>> &index,
+        std::unordered_set<WorkKey, WorkKeyHash> &candidates);
 
 private:
     ffrt::mutex mutex_;
     const std::weak_ptr<WorkSchedulerService> wss_;
     std::map<WorkCondition::Type, std::shared_ptr<WorkQueue>> queueMap_;
     std::map<WorkCondition::Type, std::shared_ptr<IConditionListener>> listenerMap_;
+    // every work once, whatever conditions it requests, used by GROUP and STANDBY and whole-set scans.
+    std::shared_ptr<WorkQueue> workRegistry_;
+    // required battery level -> work, a level change only flips works between the old and new level.
+    std::multimap<int32_t, WorkKey> batteryLevelIndex_;
+    // required network type -> works.
+    std::map<int32_t, std::unordered_set<WorkKey, WorkKeyHash>> networkIndex_;
+    // required charger bucket -> works, see GetChargerBucket.
+    std::map<int32_t, std::unordered_set<WorkKey, WorkKeyHash>> chargerIndex_;
+    // works added since the last event of a type, they are not judged against a value of it yet.
+    std::map<WorkCondition::Type, std::unordered_set<WorkKey, WorkKeyHash>> pendingWorks_;
+    std::map<WorkCondition::Type, std::shared_ptr<DetectorValue>> lastConditionVal_;
+    ffrt::mutex coalesceMutex_;
+    // condition type with an open window -> latest value not judged yet, nullptr if every event is judged.
+    std::map<WorkCondition::Type, std::shared_ptr<DetectorValue>> coalescedConditionVal_;
+    std::atomic<int64_t> coalesceWindowMs_;
+    // log the works of every condition event, otherwise once per type and interval.
+    bool printWorkStatus_ {false};
+    ffrt::mutex printMutex_;
+    std::map<WorkCondition::Type, uint64_t> lastPrintTime_;
 
     uint32_t timeCycle_;
 };
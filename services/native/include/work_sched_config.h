@@ -18,6 +18,8 @@
 #include <string>
 #include <set>
 #include <mutex>
+#include <unordered_map>
+#include "ffrt.h"
 #include "singleton.h"
 #include "nlohmann/json.hpp"
  
@@ -27,6 +29,7 @@ class WorkSchedulerConfig : public DelayedSingleton<WorkSchedulerConfig> {
 public:
     void InitActiveGroupWhitelist(const std::string &configData);
     bool IsInActiveGroupWhitelist(const std::string &bundleName);
+    void ClearSignatureCache(const std::string &bundleName);
     bool UpdateSusMgrCloudConfig(const nlohmann::json &payload);
     bool UpdateBgMgrCloudConfig(const nlohmann::json &payload);
  
@@ -35,9 +38,12 @@ private:
     void UpdateCloudConfigMinRepeatTime(const nlohmann::json &root);
     void UpdateCloudConfigEngExemptionBundles(const nlohmann::json &root);
     void UpdateCloudConfigPrinstalledWorkKey(const nlohmann::json &root);
+    void UpdateCloudConfigWeightedPolicy(const nlohmann::json &root);
 
-    std::mutex configMutex_;
+    ffrt::shared_mutex configMutex_;
     std::set<std::string> activeGroupWhitelist_ {};
+    // <bundle, signature check ok>, only whitelisted bundles are cached.
+    std::unordered_map<std::string, bool> signatureCache_;
 };
 }
 }
@@ -19,9 +19,12 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <list>
+#include <memory>
 #include "singleton.h"
 #include "ffrt.h"
+#include "work_condition.h"
 
 namespace OHOS {
 namespace WorkScheduler {
@@ -34,6 +37,12 @@ public:
     // deep idle
     void SetDeepIdle(const bool isDeepIdle);
     bool GetDeepIdle() const;
+    // charger, only kept while the charger listener is subscribed, CHARGING_UNKNOWN otherwise
+    void SetChargerSubscribed(const bool isSubscribed);
+    void SetChargerType(const int32_t chargerType);
+    // store a queried type unless the listener reported one meanwhile
+    void InitChargerType(const int32_t chargerType);
+    int32_t GetChargerType() const;
     bool IsInDeviceStandyWhitelist(const std::string& bundleName);
     void OnDeviceStandyWhitelistChanged(const std::string& bundleName, const bool add);
     void AddDeviceStandyWhitelist(const std::list<std::string>& bundleNames);
@@ -49,9 +58,18 @@ public:
     bool FindGroup(const std::string& bundleName, const int32_t userId, int32_t& appGroup);
     void ClearGroup(const std::string& bundleName, const int32_t userId);
     void ClearAllGroup();
+    // app type
+    bool FindMailApp(const std::string& bundleName, bool& isMailApp);
+    void AddMailApp(const std::string& bundleName, const bool isMailApp);
+    void ClearMailApp(const std::string& bundleName);
+    // active user
+    bool RefreshActiveUsers();
+    bool IsUserActive(const int32_t userId);
 private:
     std::atomic<bool> deviceSleep_ = false;
     std::atomic<bool> deepIdle_ = false;
+    std::atomic<bool> chargerSubscribed_ = false;
+    std::atomic<int32_t> chargerType_ = WorkCondition::Charger::CHARGING_UNKNOWN;
     ffrt::mutex deviceStandySetMutex_;
     // <bundle>
     std::set<std::string> deviceStandySet {};
@@ -61,6 +79,11 @@ private:
     ffrt::mutex activeGroupMapMutex_;
     // <bundle_userId, group>
     std::unordered_map<std::string, int32_t> activeGroupMap_;
+    ffrt::mutex mailAppMapMutex_;
+    // <bundle, isMailApp>
+    std::unordered_map<std::string, bool> mailAppMap_;
+    // <userId>, replaced as a whole by RefreshActiveUsers so lookups do not lock.
+    std::shared_ptr<const std::set<int32_t>> activeUsers_;
 };
 } // namespace WorkScheduler
 } // namespace OHOS
@@ -21,6 +21,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <atomic>
 
@@ -45,6 +46,8 @@ class WorkQueueManager;
 class WorkPolicyManager;
 class WorkBundleGroupChangeCallback;
 class SchedulerBgTaskSubscriber;
+class ThermalPolicy;
+class PowerModePolicy;
 class WorkSchedulerService final : public SystemAbility, public WorkSchedServiceStub,
     public std::enable_shared_from_this<WorkSchedulerService> {
     DISALLOW_COPY_AND_MOVE(WorkSchedulerService);
@@ -333,12 +336,17 @@ public:
     void UpdateCloudConfigMinRepeatTime(const nlohmann::json &specialRoot);
     void UpdateCloudConfigEngExemptionBundles(const nlohmann::json &exemptionBundlesRoot);
     void UpdateCloudConfigPrinstalledWorkKey(const nlohmann::json &preinstalledWorksRoot);
+    void UpdateCloudConfigWeightedPolicy(const nlohmann::json &weightedPolicyRoot);
     void StopCloudConfigWork(const std::string &workId, std::shared_ptr<WorkInfo> workInfo);
     std::map<int32_t, std::pair<int32_t, int32_t>> GetDeepIdleTimeMap();
     int32_t SetExecFrequency(const FrequencyInfo& frequencyInfo) override;
     int32_t ResetExecFrequency(const int32_t uid) override;
     void ResetExecFrequencyWhenAppRemove(int32_t uid);
     int64_t GetExecFrequency(int32_t uid, int32_t callingUid = -1);
+    /**
+     * @brief Write the exec history to its file, posted to the handler so the stop path does no file io.
+     */
+    void RefreshExecHistory();
 private:
     void RegisterStandbyStateObserver();
     void WorkQueueManagerInit(const std::shared_ptr<AppExecFwk::EventRunner>& runner);
@@ -352,6 +360,8 @@ private:
     void GroupObserverInit();
 #endif
     std::list<std::shared_ptr<WorkInfo>> ReadPersistedWorks();
+    // writes persistedMap_ to the persisted file, mutex_ must be held by the caller.
+    void RefreshPersistedWorksLocked();
     void DumpAllInfo(std::string& result);
     bool CheckWorkInfo(WorkInfo& workInfo, int32_t& uid);
     int32_t StartWorkInner(const WorkInfo& workInfo, int32_t uid);
@@ -407,7 +417,7 @@ private:
     bool CheckCloudConfigPreinstallDelete(const nlohmann::json &workJson);
     bool CheckPreinstalledWorkId(const std::string &workId);
     void RemovePreinstalledWorkId(const std::string &workId);
-    void RemovePersistedMap(const std::string &workId);
+    void RemovePersistedMap(const WorkKey &workKey);
     void RemovePreinstalledBundles(const std::string &bundleName);
     void RemoveDeepIdleTimeToMap(const int32_t saId);
     void ReStartCloudConfigPreinstalledWork(std::list<std::shared_ptr<WorkInfo>> &workInfos);
@@ -420,6 +430,8 @@ private:
     std::string ParseFrequencyMapToJsonStr();
     void RefreshPersistedInfos();
     bool CreateNodePersistedInfoFile();
+    void InitExecHistory();
+    bool WriteExecHistory(const std::string &result);
     void DumpTwoParamsSet(std::vector<std::string> &argsInStr, std::string &result);
     void DumpAppGroup(const std::string& bundleName, const std::string& groupStr, std::string& result);
 
@@ -432,9 +444,10 @@ private:
     std::shared_ptr<WorkQueueManager> workQueueManager_;
     std::shared_ptr<WorkPolicyManager> workPolicyManager_;
     std::shared_ptr<BackgroundLoaderMgr> backgroundLoaderMgr_;
-    ffrt::recursive_mutex mutex_;
+    // guards persistedMap_, see work_lock_order.h for the order of the scheduler locks.
+    ffrt::mutex mutex_;
     ffrt::mutex observerMutex_;
-    std::map<std::string, std::shared_ptr<WorkInfo>> persistedMap_;
+    std::unordered_map<WorkKey, std::shared_ptr<WorkInfo>, WorkKeyHash> persistedMap_;
     std::atomic<bool> ready_ {false};
     std::shared_ptr<WorkEventHandler> handler_;
     std::shared_ptr<AppExecFwk::EventRunner> eventRunner_;
@@ -447,6 +460,12 @@ private:
 #endif
 #ifdef  DEVICE_STANDBY_ENABLE
     sptr<WorkStandbyStateChangeCallback> standbyStateObserver_;
+#endif
+#ifdef POWERMGR_THERMAL_MANAGER_ENABLE
+    std::shared_ptr<ThermalPolicy> thermalFilter_;
+#endif
+#ifdef POWERMGR_POWER_MANAGER_ENABLE
+    std::shared_ptr<PowerModePolicy> powerModeFilter_;
 #endif
     uint32_t minTimeCycle_ = 20 * 60 * 1000;
     uint32_t minCheckTime_ = 0;
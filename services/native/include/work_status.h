@@ -16,13 +16,19 @@
 #ifndef WORK_SCHED_SERVICES_WORK_STATUS_H
 #define WORK_SCHED_SERVICES_WORK_STATUS_H
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <map>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "system_state_snapshot.h"
 #include "timer.h"
 #include "work_info.h"
+#include "work_key.h"
 #include "ffrt.h"
 
 namespace OHOS {
@@ -46,11 +52,20 @@ public:
      * @return Workid and uid.
      */
     static std::string MakeWorkId(int32_t workId, int32_t uid);
+    /**
+     * @brief Make work key.
+     *
+     * @param workId The id of work.
+     * @param uid The uid.
+     * @return The packed key of uid and workId.
+     */
+    static WorkKey MakeWorkKey(int32_t workId, int32_t uid);
     time_t getOppositeTime();
     static void ClearDumpAppGroup(int32_t uid);
     static void AddDumpAppGroup(int32_t uid, int32_t group);
 
     std::string workId_;
+    WorkKey workKey_;
     std::string bundleName_;
     std::string abilityName_;
     int32_t uid_;
@@ -63,7 +78,7 @@ public:
     int32_t priority_;
     bool needRetrigger_ {false};
     int32_t timeRetrigger_ {INT32_MAX};
-    std::map<WorkCondition::Type, std::shared_ptr<Condition>> conditionMap_;
+    ConditionSlots conditionMap_;
     std::shared_ptr<WorkInfo> workInfo_;
     std::string delayReason_;
 
@@ -122,6 +137,20 @@ public:
      * @param value The value.
      */
     int32_t OnConditionChanged(WorkCondition::Type &type, std::shared_ptr<Condition> value);
+    /**
+     * @brief Record the current value of a condition without judging readiness.
+     *
+     * @param type The type.
+     * @param value The value.
+     */
+    void UpdateCondition(WorkCondition::Type type, std::shared_ptr<Condition> value);
+    /**
+     * @brief Get the current value of a required condition.
+     *
+     * @param type The type.
+     * @return The value of the work itself if it has one, else the value in the latest system state snapshot.
+     */
+    std::shared_ptr<Condition> GetCurrentCondition(WorkCondition::Type type);
     /**
      * @brief Mark round.
      */
@@ -217,19 +246,138 @@ public:
     bool HasTimeout();
     bool IsTimeout();
     void SetTimeout(bool timeout);
+    /**
+     * @brief Take the keys of the works marked timed out since the last call.
+     *
+     * @return The keys of the timed out works.
+     */
+    static std::unordered_set<WorkKey, WorkKeyHash> TakeTimeoutWorks();
+    /**
+     * @brief Lower the earliest time a running work may time out to the deadline of this work,
+     *        called when its watchdog starts.
+     */
+    void ArmTimeoutDeadline();
+    /**
+     * @brief Check whether the earliest timeout deadline passed, and reset it if so.
+     *
+     * @param now The current time in milliseconds.
+     * @return True if the running works should be probed for timeouts.
+     */
+    static bool TakeDueTimeoutDeadline(uint64_t now);
+    /**
+     * @brief Get the count of running works, kept up to date by MarkStatus.
+     *
+     * @return The count of running works.
+     */
+    static int32_t GetRunningCount();
+    /**
+     * @brief Get the count of running works of an uid.
+     *
+     * @param uid The uid.
+     * @return The count of running works of the uid.
+     */
+    static int32_t GetUidRunningCount(int32_t uid);
+    /**
+     * @brief Get the count of running works of a bundle.
+     *
+     * @param bundleName The bundle name.
+     * @return The count of running works of the bundle.
+     */
+    static int32_t GetBundleRunningCount(const std::string &bundleName);
+    /**
+     * @brief Set the cost charged while the work runs, it can not change while the work is running.
+     *
+     * @param cost The cost, WORK_COST_UNIT per running slot.
+     */
+    void SetRunningCost(int32_t cost);
+    /**
+     * @brief Get the summed cost of the running works, kept up to date by MarkStatus.
+     *
+     * @return The cost of running works.
+     */
+    static int32_t GetRunningCost();
+    /**
+     * @brief Get the keys of the ready and running works, kept up to date by MarkStatus.
+     *
+     * @param workKeys The keys of the ready and running works.
+     */
+    static void GetActiveWorks(std::vector<WorkKey> &workKeys);
     bool IsSpecial();
     double TimeUntilLast();
     bool IsDebugTask();
     void SetDebugTask(bool debugTask);
 private:
-    Status currentStatus_;
+    void UpdateRunningCount(int32_t delta);
+    void UpdateActiveWorks(int32_t delta);
+
+    std::atomic<Status> currentStatus_ {WAIT_CONDITION};
+    std::atomic<int32_t> runningCost_ {0};
     time_t baseTime_;
     int64_t minInterval_;
     bool groupChanged_;
     ffrt::mutex conditionMapMutex_;
     static ffrt::mutex s_uid_last_time_mutex;
     static std::map<int32_t, time_t> s_uid_last_time_map;
-    std::string conditionStatus_;
+    static ffrt::mutex s_timeout_works_mutex;
+    static std::unordered_set<WorkKey, WorkKeyHash> s_timeout_works;
+    static std::atomic<uint64_t> s_timeout_deadline;
+    static std::atomic<int32_t> s_running_count;
+    static std::atomic<int32_t> s_running_cost;
+    static ffrt::mutex s_running_count_mutex;
+    static std::unordered_map<int32_t, int32_t> s_uid_running_count;
+    static std::unordered_map<std::string, int32_t> s_bundle_running_count;
+    static ffrt::mutex s_active_works_mutex;
+    // workKey -> count of ready or running instances, a re-added work may briefly have two.
+    static std::unordered_map<WorkKey, int32_t, WorkKeyHash> s_active_works;
+    /**
+     * @brief Result of the last readiness evaluation, only formatted into a string by ToString.
+     */
+    struct ConditionStatus {
+        enum Flag : uint32_t {
+            NOT_SAME_USER = 1u << 0,
+            RUNNING = 1u << 1,
+            URI_KEY_OFF = 1u << 2,
+            EFFI_RES_WHITELIST = 1u << 3,
+            FIRST_TRIGGER = 1u << 4,
+        };
+        uint32_t flags {0};
+        // Bit n is set if condition type n was judged ready or not ready.
+        uint32_t okMask {0};
+        uint32_t notOkMask {0};
+        // Elapsed and required time of the not ready TIMER or GROUP, set if the bit is in detailMask.
+        uint32_t detailMask {0};
+        int64_t timerElapsed {0};
+        int64_t timerRequired {0};
+        int64_t groupElapsed {0};
+        int64_t groupRequired {0};
+
+        void Clear()
+        {
+            *this = ConditionStatus();
+        }
+        bool IsEmpty() const
+        {
+            return flags == 0 && okMask == 0 && notOkMask == 0;
+        }
+        void SetFlag(Flag flag)
+        {
+            flags |= flag;
+        }
+        void SetResult(WorkCondition::Type type, bool ok)
+        {
+            (ok ? okMask : notOkMask) |= ConditionSlots::TypeBit(type);
+        }
+        void SetNotOk(WorkCondition::Type type, int64_t elapsed, int64_t required);
+        std::string Format() const;
+    };
+    ConditionStatus conditionStatus_;
+    // Bit n is set if the current value of condition type n meets the requirement, timer is judged on each call.
+    uint32_t satisfiedMask_ {0};
+    uint32_t satisfiedRequiredMask_ {0};
+    std::weak_ptr<WorkInfo> satisfiedWorkInfo_;
+    // System state the satisfied mask was judged against.
+    std::shared_ptr<const SystemStateSnapshot> snapshot_;
+    uint64_t snapshotVersion_ {0};
     std::atomic<bool> timeout_ {false};
     std::atomic<bool> debugTask_ {false};
     void MarkTimeout();
@@ -242,6 +390,9 @@ private:
     int GetPriority();
     bool IsTimerReady(WorkCondition::Type type);
     bool IsConditionReady();
+    void RefreshSatisfiedMask(uint32_t requiredMask);
+    const std::shared_ptr<Condition> &GetConditionValue(WorkCondition::Type type,
+        const std::shared_ptr<const SystemStateSnapshot> &snapshot) const;
     bool IsStandbyExemption();
     bool CheckEarliestStartTime();
     int64_t HandleMinInterval(int64_t interval, int32_t group);
@@ -20,6 +20,7 @@
 #include "common_event_support.h"
 #include "matching_skills.h"
 #include "want.h"
+#include "work_sched_data_manager.h"
 #include "work_sched_hilog.h"
 
 namespace OHOS {
@@ -94,7 +95,13 @@ bool ChargerListener::Start()
 {
     WS_HILOGI("Charger listener start");
     this->commonEventSubscriber = CreateChargerEventSubscriber(*this);
-    return EventFwk::CommonEventManager::SubscribeCommonEvent(this->commonEventSubscriber);
+    // subscribed first, so that an event arriving during the subscription is kept.
+    DelayedSingleton<DataManager>::GetInstance()->SetChargerSubscribed(true);
+    bool result = EventFwk::CommonEventManager::SubscribeCommonEvent(this->commonEventSubscriber);
+    if (!result) {
+        DelayedSingleton<DataManager>::GetInstance()->SetChargerSubscribed(false);
+    }
+    return result;
 }
 
 bool ChargerListener::Stop()
@@ -104,6 +111,7 @@ bool ChargerListener::Stop()
         bool result = EventFwk::CommonEventManager::UnSubscribeCommonEvent(this->commonEventSubscriber);
         if (result) {
             this->commonEventSubscriber = nullptr;
+            DelayedSingleton<DataManager>::GetInstance()->SetChargerSubscribed(false);
         }
         return result;
     }
@@ -113,6 +121,9 @@ bool ChargerListener::Stop()
 void ChargerListener::OnConditionChanged(WorkCondition::Type conditionType,
     std::shared_ptr<DetectorValue> conditionVal)
 {
+    if (conditionType == WorkCondition::Type::CHARGER && conditionVal != nullptr) {
+        DelayedSingleton<DataManager>::GetInstance()->SetChargerType(conditionVal->intVal);
+    }
     if (workQueueManager_ != nullptr) {
         workQueueManager_->OnConditionChanged(conditionType, conditionVal);
     } else {
@@ -20,6 +20,7 @@
 #include "battery_srv_client.h"
 #include "battery_info.h"
 #endif
+#include "work_sched_data_manager.h"
 #include "work_sched_hilog.h"
 
 using namespace OHOS::NetManagerStandard;
@@ -79,37 +80,40 @@ void ConditionChecker::CheckChargerStatus()
 {
 #ifdef POWERMGR_BATTERY_MANAGER_ENABLE
     WS_HILOGD("enter");
+    int32_t chargerType = DelayedSingleton<DataManager>::GetInstance()->GetChargerType();
+    if (chargerType == WorkCondition::CHARGING_UNKNOWN) {
+        chargerType = QueryChargerType();
+        if (chargerType == WorkCondition::CHARGING_UNKNOWN) {
+            return;
+        }
+        DelayedSingleton<DataManager>::GetInstance()->InitChargerType(chargerType);
+    }
+    WS_HILOGI("charger type: %{public}d", chargerType);
+    workQueueManager_->OnConditionChanged(WorkCondition::Type::CHARGER,
+        std::make_shared<DetectorValue>(chargerType, 0, chargerType != WorkCondition::CHARGING_UNPLUGGED,
+        std::string()));
+#endif
+}
+
+int32_t ConditionChecker::QueryChargerType()
+{
+#ifdef POWERMGR_BATTERY_MANAGER_ENABLE
     auto type = PowerMgr::BatterySrvClient::GetInstance().GetPluggedType();
     switch (type) {
         case PowerMgr::BatteryPluggedType::PLUGGED_TYPE_AC:
-            WS_HILOGI("CHARGER_PLUGGED_AC");
-            workQueueManager_->OnConditionChanged(WorkCondition::Type::CHARGER,
-                std::make_shared<DetectorValue>(WorkCondition::CHARGING_PLUGGED_AC,
-                0, true, std::string()));
-            break;
+            return WorkCondition::CHARGING_PLUGGED_AC;
         case PowerMgr::BatteryPluggedType::PLUGGED_TYPE_USB:
-            WS_HILOGI("CHARGER_PLUGGED_USB");
-            workQueueManager_->OnConditionChanged(WorkCondition::Type::CHARGER,
-                std::make_shared<DetectorValue>(WorkCondition::CHARGING_PLUGGED_USB,
-                0, true, std::string()));
-            break;
+            return WorkCondition::CHARGING_PLUGGED_USB;
         case PowerMgr::BatteryPluggedType::PLUGGED_TYPE_WIRELESS:
-            WS_HILOGI("CHARGER_WIRELESS");
-            workQueueManager_->OnConditionChanged(WorkCondition::Type::CHARGER,
-                std::make_shared<DetectorValue>(WorkCondition::CHARGING_PLUGGED_WIRELESS,
-                0, true, std::string()));
-            break;
-
+            return WorkCondition::CHARGING_PLUGGED_WIRELESS;
         case PowerMgr::BatteryPluggedType::PLUGGED_TYPE_NONE:
         case PowerMgr::BatteryPluggedType::PLUGGED_TYPE_BUTT:
-            WS_HILOGI("CHARGER_PLUGGED_UNPLUGGED");
-            workQueueManager_->OnConditionChanged(WorkCondition::Type::CHARGER,
-                std::make_shared<DetectorValue>(WorkCondition::CHARGING_UNPLUGGED, 0, false, std::string()));
-            break;
+            return WorkCondition::CHARGING_UNPLUGGED;
         default:
             break;
     }
 #endif
+    return WorkCondition::CHARGING_UNKNOWN;
 }
 
 void ConditionChecker::CheckBatteryStatus()
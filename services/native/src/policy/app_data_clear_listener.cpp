@@ -51,6 +51,8 @@ void AppDataClearSubscriber::OnReceiveEvent(const CommonEventData &data)
         listener_.OnPolicyChanged(PolicyType::USER_SWITCHED, detectorVal);
     } else if (action == CommonEventSupport::COMMON_EVENT_USER_STARTED) {
         listener_.OnPolicyChanged(PolicyType::USER_STARTED, detectorVal);
+    } else if (action == CommonEventSupport::COMMON_EVENT_USER_STOPPED) {
+        listener_.OnPolicyChanged(PolicyType::USER_STOPPED, detectorVal);
     }
 }
 
@@ -63,6 +65,7 @@ shared_ptr<CommonEventSubscriber> CreateAppDataClearSubscriber(AppDataClearListe
     skill.AddEvent(CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
     skill.AddEvent(CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
     skill.AddEvent(CommonEventSupport::COMMON_EVENT_USER_STARTED);
+    skill.AddEvent(CommonEventSupport::COMMON_EVENT_USER_STOPPED);
     CommonEventSubscribeInfo info(skill);
     return make_shared<AppDataClearSubscriber>(info, listener);
 }
@@ -30,6 +30,7 @@ const int32_t COUNT_CPU_NORMAL = 2;
 const int32_t COUNT_CPU_LOW = 3;
 const int32_t CPU_UPPER_LIMIT = 100;
 const int32_t UNIT = 100;
+const int64_t CPU_SAMPLE_TTL_MS = 10 * 1000;
 
 CpuPolicy::CpuPolicy(shared_ptr<WorkPolicyManager> workPolicyManager)
 {
@@ -78,5 +79,10 @@ int32_t CpuPolicy::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
     WS_HILOGD("cpu_usage: %{public}d, policyRes: %{public}d", cpuUsage, policyRes);
     return policyRes;
 }
+
+int64_t CpuPolicy::GetSampleTtlMs()
+{
+    return CPU_SAMPLE_TTL_MS;
+}
 } // namespace WorkScheduler
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "policy/mem_info_reader.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "work_sched_hilog.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+namespace {
+const char MEM_INFO_PATH[] = "/proc/meminfo";
+const char MEM_PRESSURE_PATH[] = "/proc/pressure/memory";
+const char MEM_AVAILABLE_KEY[] = "MemAvailable:";
+const char SOME_AVG10_KEY[] = "some avg10=";
+// MemAvailable is the third line of meminfo, "some" the first line of the psi file.
+const size_t MEM_INFO_BUF_SIZE = 512;
+const size_t MEM_PRESSURE_BUF_SIZE = 128;
+const int32_t INVALID_VALUE = -1;
+const int32_t DECIMAL_BASE = 10;
+const int32_t FRACTION_DIGITS = 2;
+const int32_t MAX_PERCENT = 100;
+
+int32_t OpenReadOnly(const char *path)
+{
+    int32_t fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        WS_HILOGW("open %{public}s failed, errno: %{public}d", path, errno);
+    }
+    return fd;
+}
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+}
+
+MemInfoReader::MemInfoReader()
+{
+    memInfoFd_ = OpenReadOnly(MEM_INFO_PATH);
+    pressureFd_ = OpenReadOnly(MEM_PRESSURE_PATH);
+}
+
+MemInfoReader::~MemInfoReader()
+{
+    if (memInfoFd_ >= 0) {
+        close(memInfoFd_);
+    }
+    if (pressureFd_ >= 0) {
+        close(pressureFd_);
+    }
+}
+
+int32_t MemInfoReader::ReadMemAvailable()
+{
+    char buf[MEM_INFO_BUF_SIZE];
+    if (ReadFile(memInfoFd_, buf, sizeof(buf)) == 0) {
+        return INVALID_VALUE;
+    }
+    return ParseMemAvailable(buf);
+}
+
+int32_t MemInfoReader::ReadMemPressure()
+{
+    char buf[MEM_PRESSURE_BUF_SIZE];
+    if (ReadFile(pressureFd_, buf, sizeof(buf)) == 0) {
+        return INVALID_VALUE;
+    }
+    return ParseSomeAvg10(buf);
+}
+
+size_t MemInfoReader::ReadFile(int32_t fd, char *buf, size_t size)
+{
+    if (fd < 0 || size == 0) {
+        return 0;
+    }
+    ssize_t len = 0;
+    do {
+        len = pread(fd, buf, size - 1, 0);
+    } while (len < 0 && errno == EINTR);
+    if (len <= 0) {
+        WS_HILOGE("pread failed, errno: %{public}d", errno);
+        return 0;
+    }
+    buf[len] = '\0';
+    return static_cast<size_t>(len);
+}
+
+int32_t MemInfoReader::ParseMemAvailable(const char *buf)
+{
+    const char *pos = strstr(buf, MEM_AVAILABLE_KEY);
+    if (pos == nullptr) {
+        return INVALID_VALUE;
+    }
+    pos += sizeof(MEM_AVAILABLE_KEY) - 1;
+    while (*pos == ' ') {
+        pos++;
+    }
+    if (!IsDigit(*pos)) {
+        return INVALID_VALUE;
+    }
+    int64_t value = 0;
+    for (; IsDigit(*pos); pos++) {
+        value = value * DECIMAL_BASE + (*pos - '0');
+        if (value > INT32_MAX) {
+            return INT32_MAX;
+        }
+    }
+    return static_cast<int32_t>(value);
+}
+
+int32_t MemInfoReader::ParseSomeAvg10(const char *buf)
+{
+    const char *pos = strstr(buf, SOME_AVG10_KEY);
+    if (pos == nullptr) {
+        return INVALID_VALUE;
+    }
+    pos += sizeof(SOME_AVG10_KEY) - 1;
+    if (!IsDigit(*pos)) {
+        return INVALID_VALUE;
+    }
+    // the kernel prints the averages as percentages with two decimals, at most 100.00.
+    int32_t value = 0;
+    for (; IsDigit(*pos); pos++) {
+        if (value <= MAX_PERCENT) {
+            value = value * DECIMAL_BASE + (*pos - '0');
+        }
+    }
+    if (value > MAX_PERCENT) {
+        return MAX_PERCENT * DECIMAL_BASE * DECIMAL_BASE;
+    }
+    int32_t fraction = 0;
+    int32_t digits = 0;
+    if (*pos == '.') {
+        for (pos++; IsDigit(*pos) && digits < FRACTION_DIGITS; pos++, digits++) {
+            fraction = fraction * DECIMAL_BASE + (*pos - '0');
+        }
+    }
+    for (; digits < FRACTION_DIGITS; digits++) {
+        fraction *= DECIMAL_BASE;
+    }
+    return value * DECIMAL_BASE * DECIMAL_BASE + fraction;
+}
+} // namespace WorkScheduler
+} // namespace OHOS
@@ -14,22 +14,24 @@
  */
 #include "policy/memory_policy.h"
 
-#include <fstream>
-#include <securec.h>
+#include <algorithm>
+
 #include "work_sched_hilog.h"
 
 using namespace std;
 
 namespace OHOS {
 namespace WorkScheduler {
-const int32_t BUF_LIMIT = 128;
-const int32_t NAME_SIZE = 128;
 const int32_t INVALID_MEM = -1;
 const int32_t MEM_CRUCIAL = 1 * 1024 * 1024;
 const int32_t MEM_LOW = 2 * 1024 * 1024;
+// some avg10 of the memory psi, in hundredths of a percent.
+const int32_t MEM_PRESSURE_CRUCIAL = 30 * 100;
+const int32_t MEM_PRESSURE_LOW = 10 * 100;
 const int32_t COUNT_MEMORY_CRUCIAL = 1;
 const int32_t COUNT_MEMORY_LOW = 2;
 const int32_t COUNT_MEMORY_NORMAL = 3;
+const int64_t MEMORY_SAMPLE_TTL_MS = 5 * 1000;
 
 MemoryPolicy::MemoryPolicy(shared_ptr<WorkPolicyManager> workPolicyManager)
 {
@@ -49,34 +51,28 @@ int32_t MemoryPolicy::GetMemAvailable()
             return dumpSetMemory;
         }
     }
-    int32_t memAvailable = INVALID_MEM;
-    FILE *fp = fopen("/proc/meminfo", "r");
-    if (fp == nullptr) {
-        WS_HILOGE("GetMemAvailable file open failed.");
-        return memAvailable;
-    }
-    char buf[BUF_LIMIT];
-    int32_t buff_len = BUF_LIMIT;
-    const char mem_name[] = "MemAvailable";
-    char name[NAME_SIZE];
-    int32_t value = -1;
-    while (fgets(buf, buff_len, fp) != nullptr) {
-        int32_t res = sscanf_s(buf, "%s%d", name, sizeof(name), &value);
-        if (res < 0) {
-            WS_HILOGE("sscanf_s failed");
-            break;
-        }
-        string sname = name;
-        if (sname.find(mem_name) != string::npos) {
-            memAvailable = value;
-            break;
-        }
+    int32_t memAvailable = memInfoReader_.ReadMemAvailable();
+    if (memAvailable == INVALID_MEM) {
+        WS_HILOGE("GetMemAvailable read meminfo failed.");
     }
-    fclose(fp);
-    fp = nullptr;
     return memAvailable;
 }
 
+int32_t MemoryPolicy::GetMemPressureMaxRunning()
+{
+    if (workPolicyManager_ != nullptr && workPolicyManager_->GetDumpSetMemory() != -1) {
+        return COUNT_MEMORY_NORMAL;
+    }
+    int32_t pressure = memInfoReader_.ReadMemPressure();
+    WS_HILOGD("mem_pressure: %{public}d", pressure);
+    if (pressure >= MEM_PRESSURE_CRUCIAL) {
+        return COUNT_MEMORY_CRUCIAL;
+    } else if (pressure >= MEM_PRESSURE_LOW) {
+        return COUNT_MEMORY_LOW;
+    }
+    return COUNT_MEMORY_NORMAL;
+}
+
 int32_t MemoryPolicy::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
 {
     int32_t memAvailable = GetMemAvailable();
@@ -87,10 +83,16 @@ int32_t MemoryPolicy::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
     } else if (memAvailable <= MEM_LOW) {
         res = COUNT_MEMORY_LOW;
     }
+    res = std::min(res, GetMemPressureMaxRunning());
     systemPolicy.memAvailable = memAvailable;
     systemPolicy.SetPolicyName("MEMORY_POLICY", res);
     WS_HILOGD("memory left normal");
     return res;
 }
+
+int64_t MemoryPolicy::GetSampleTtlMs()
+{
+    return MEMORY_SAMPLE_TTL_MS;
+}
 } // namespace WorkScheduler
 } // namespace OHOS
\ No newline at end of file
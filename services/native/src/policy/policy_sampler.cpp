@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "policy/policy_sampler.h"
+
+#include <climits>
+
+#include "work_sched_utils.h"
+
+using namespace std;
+
+namespace OHOS {
+namespace WorkScheduler {
+namespace {
+// marks the values of a sample the filter did not set.
+const int32_t UNSAMPLED_VALUE = INT32_MIN;
+const uint32_t UNSAMPLED_POWER_MODE = UINT32_MAX;
+const std::string UNSAMPLED_POLICY_NAME = "NONE";
+}
+
+PolicySampler::PolicySampler(shared_ptr<IPolicyFilter> filter) : filter_(filter) {}
+
+int32_t PolicySampler::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
+{
+    int64_t ttlMs = filter_->GetSampleTtlMs();
+    if (ttlMs <= 0) {
+        return filter_->GetPolicyMaxRunning(systemPolicy);
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (hasSample_) {
+            if (WorkSchedUtils::GetCurrentTimeMs() - sampleTimeMs_ >= static_cast<uint64_t>(ttlMs)) {
+                RefreshAsync();
+            }
+            Apply(cachedSample_, cachedRes_, systemPolicy);
+            return cachedRes_;
+        }
+    }
+    WorkSchedSystemPolicy sample;
+    int32_t res = Sample(sample);
+    Apply(sample, res, systemPolicy);
+    return res;
+}
+
+void PolicySampler::Invalidate()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    hasSample_ = false;
+    generation_++;
+}
+
+int32_t PolicySampler::Sample(WorkSchedSystemPolicy &sample)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        generation = generation_;
+    }
+    sample.cpuUsage = UNSAMPLED_VALUE;
+    sample.memAvailable = UNSAMPLED_VALUE;
+    sample.thermalLevel = UNSAMPLED_VALUE;
+    sample.powerMode = UNSAMPLED_POWER_MODE;
+    int32_t res = filter_->GetPolicyMaxRunning(sample);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (generation != generation_) {
+        // invalidated while sampling, the sample may predate the change, so it is not cached.
+        return res;
+    }
+    cachedSample_ = sample;
+    cachedRes_ = res;
+    sampleTimeMs_ = WorkSchedUtils::GetCurrentTimeMs();
+    hasSample_ = true;
+    return res;
+}
+
+void PolicySampler::RefreshAsync()
+{
+    if (refreshing_.exchange(true)) {
+        return;
+    }
+    ffrt::submit([weak = weak_from_this()]() {
+        auto sampler = weak.lock();
+        if (!sampler) {
+            return;
+        }
+        WorkSchedSystemPolicy sample;
+        sampler->Sample(sample);
+        sampler->refreshing_.store(false);
+    });
+}
+
+void PolicySampler::Apply(const WorkSchedSystemPolicy &sample, int32_t res, WorkSchedSystemPolicy &systemPolicy)
+{
+    if (sample.cpuUsage != UNSAMPLED_VALUE) {
+        systemPolicy.cpuUsage = sample.cpuUsage;
+    }
+    if (sample.memAvailable != UNSAMPLED_VALUE) {
+        systemPolicy.memAvailable = sample.memAvailable;
+    }
+    if (sample.thermalLevel != UNSAMPLED_VALUE) {
+        systemPolicy.thermalLevel = sample.thermalLevel;
+    }
+    if (sample.powerMode != UNSAMPLED_POWER_MODE) {
+        systemPolicy.powerMode = sample.powerMode;
+    }
+    if (sample.policyName != UNSAMPLED_POLICY_NAME) {
+        systemPolicy.SetPolicyName(sample.policyName, res);
+    }
+}
+} // namespace WorkScheduler
+} // namespace OHOS
@@ -19,6 +19,7 @@
 #endif
 #include "power_mgr_client.h"
 #include "power_mode_info.h"
+#include "work_sched_data_manager.h"
 #include "work_sched_hilog.h"
 
 using namespace std;
@@ -30,37 +31,146 @@ namespace WorkScheduler {
 const int32_t COUNT_POWER_MODE_CRUCIAL = 1;
 #endif
 const int32_t COUNT_POWER_MODE_NORMAL = 3;
+const int64_t POWER_MODE_SAMPLE_TTL_MS = 30 * 1000;
+const uint32_t INVALID_POWER_MODE = 0;
 
-PowerModePolicy::PowerModePolicy(shared_ptr<WorkPolicyManager> workPolicyManager)
+PowerModePolicy::PowerModeCallback::PowerModeCallback(weak_ptr<PowerModePolicy> powerModePolicy)
+    : powerModePolicy_(powerModePolicy) {}
+
+void PowerModePolicy::PowerModeCallback::OnPowerModeChanged(PowerMode mode)
+{
+    auto powerModePolicy = powerModePolicy_.lock();
+    if (powerModePolicy != nullptr) {
+        powerModePolicy->OnPowerModeChanged(mode);
+    }
+}
+
+PowerModePolicy::PowerModePolicy(shared_ptr<WorkPolicyManager> workPolicyManager) : powerMode_(INVALID_POWER_MODE)
 {
     workPolicyManager_ = workPolicyManager;
 }
 
 PowerModePolicy::~PowerModePolicy()
 {
+    Unsubscribe();
 }
 
-int32_t PowerModePolicy::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
+bool PowerModePolicy::Subscribe()
+{
+    std::lock_guard<ffrt::mutex> lock(callbackMutex_);
+    if (powerModeCallback_ != nullptr) {
+        return true;
+    }
+    sptr<PowerModeCallback> callback = new (std::nothrow) PowerModeCallback(weak_from_this());
+    if (callback == nullptr) {
+        WS_HILOGE("create power mode callback failed");
+        return false;
+    }
+    if (!PowerMgrClient::GetInstance().RegisterPowerModeCallback(callback)) {
+        WS_HILOGE("register power mode callback failed");
+        return false;
+    }
+    powerModeCallback_ = callback;
+    uint32_t mode = static_cast<uint32_t>(PowerMgrClient::GetInstance().GetDeviceMode());
+    uint32_t expected = INVALID_POWER_MODE;
+    powerMode_.compare_exchange_strong(expected, mode);
+    WS_HILOGI("register power mode callback success, power mode: %{public}u", powerMode_.load());
+    return true;
+}
+
+void PowerModePolicy::Unsubscribe()
+{
+    std::lock_guard<ffrt::mutex> lock(callbackMutex_);
+    if (powerModeCallback_ == nullptr) {
+        return;
+    }
+    PowerMgrClient::GetInstance().UnRegisterPowerModeCallback(powerModeCallback_);
+    powerModeCallback_ = nullptr;
+    powerMode_.store(INVALID_POWER_MODE);
+}
+
+void PowerModePolicy::OnServiceRemoved()
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(callbackMutex_);
+        if (powerModeCallback_ == nullptr) {
+            return;
+        }
+        // the callback died with the service, nothing is left to unregister.
+        powerModeCallback_ = nullptr;
+        powerMode_.store(INVALID_POWER_MODE);
+    }
+    WS_HILOGI("power manager removed, poll the power mode");
+    if (workPolicyManager_ != nullptr) {
+        workPolicyManager_->InvalidatePolicySamples();
+    }
+}
+
+void PowerModePolicy::OnPowerModeChanged(PowerMode mode)
+{
+    uint32_t lastMode = powerMode_.exchange(static_cast<uint32_t>(mode));
+    if (lastMode == static_cast<uint32_t>(mode) || workPolicyManager_ == nullptr) {
+        return;
+    }
+    WS_HILOGI("power mode changed from %{public}u to %{public}u", lastMode, static_cast<uint32_t>(mode));
+    workPolicyManager_->InvalidatePolicySamples();
+    if (lastMode == INVALID_POWER_MODE ||
+        GetPowerModeMaxRunning(mode) > GetPowerModeMaxRunning(static_cast<PowerMode>(lastMode))) {
+        workPolicyManager_->SendRetrigger(0);
+    }
+}
+
+#ifdef POWERMGR_BATTERY_MANAGER_ENABLE
+bool PowerModePolicy::IsCharging()
+{
+    int32_t chargerType = DelayedSingleton<DataManager>::GetInstance()->GetChargerType();
+    if (chargerType != WorkCondition::Charger::CHARGING_UNKNOWN) {
+        return chargerType != WorkCondition::Charger::CHARGING_UNPLUGGED;
+    }
+    auto charge = BatterySrvClient::GetInstance().GetChargingStatus();
+    WS_HILOGD("charge: %{public}d", charge);
+    return charge != BatteryChargeState::CHARGE_STATE_NONE && charge != BatteryChargeState::CHARGE_STATE_DISABLE;
+}
+#endif
+
+PowerMode PowerModePolicy::GetPowerMode()
+{
+    uint32_t pushedMode = powerMode_.load();
+    if (pushedMode != INVALID_POWER_MODE) {
+        return static_cast<PowerMode>(pushedMode);
+    }
+    return PowerMgrClient::GetInstance().GetDeviceMode();
+}
+
+int32_t PowerModePolicy::GetPowerModeMaxRunning(PowerMode mode)
 {
     int32_t res = COUNT_POWER_MODE_NORMAL;
-    auto mode = PowerMgrClient::GetInstance().GetDeviceMode();
     if (mode == PowerMode::NORMAL_MODE || mode == PowerMode::PERFORMANCE_MODE) {
-        WS_HILOGD("power mode: %{public}d, PolicyRes: %{public}d", mode, res);
-        systemPolicy.powerMode = static_cast<uint32_t>(mode);
-        systemPolicy.SetPolicyName("POWER_MODE_POLICY", res);
         return res;
     }
 #ifdef POWERMGR_BATTERY_MANAGER_ENABLE
-    auto charge = BatterySrvClient::GetInstance().GetChargingStatus();
-    if (charge == BatteryChargeState::CHARGE_STATE_NONE || charge == BatteryChargeState::CHARGE_STATE_DISABLE) {
+    if (!IsCharging()) {
         res = COUNT_POWER_MODE_CRUCIAL;
-        WS_HILOGD("charge: %{public}d, power mode: %{public}d, PolicyRes: %{public}d", charge, mode, res);
+        WS_HILOGD("not charging, power mode: %{public}d, PolicyRes: %{public}d", mode, res);
     }
 #endif
+    return res;
+}
+
+int32_t PowerModePolicy::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
+{
+    auto mode = GetPowerMode();
+    int32_t res = GetPowerModeMaxRunning(mode);
     WS_HILOGD("power mode: %{public}d, PolicyRes: %{public}d", mode, res);
     systemPolicy.powerMode = static_cast<uint32_t>(mode);
     systemPolicy.SetPolicyName("POWER_MODE_POLICY", res);
     return res;
 }
+
+int64_t PowerModePolicy::GetSampleTtlMs()
+{
+    // a pushed mode is read without ipc, only the charging state may still be queried.
+    return powerMode_.load() != INVALID_POWER_MODE ? 0 : POWER_MODE_SAMPLE_TTL_MS;
+}
 } // namespace WorkScheduler
 } // namespace OHOS
\ No newline at end of file
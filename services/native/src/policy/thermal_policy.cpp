@@ -27,8 +27,23 @@ const int32_t COUNT_THERMAL_CRUCIAL = 0;
 const int32_t COUNT_THERMAL_LOW = 1;
 const int32_t COUNT_THERMAL_MIDDLE = 2;
 const int32_t COUNT_THERMAL_NORMAL = 3;
+const int64_t THERMAL_SAMPLE_TTL_MS = 30 * 1000;
+const int32_t INVALID_THERMAL_LEVEL = -1;
 
-ThermalPolicy::ThermalPolicy(shared_ptr<WorkPolicyManager> workPolicyManager)
+ThermalPolicy::ThermalLevelCallback::ThermalLevelCallback(weak_ptr<ThermalPolicy> thermalPolicy)
+    : thermalPolicy_(thermalPolicy) {}
+
+bool ThermalPolicy::ThermalLevelCallback::OnThermalLevelChanged(ThermalLevel level)
+{
+    auto thermalPolicy = thermalPolicy_.lock();
+    if (thermalPolicy == nullptr) {
+        return false;
+    }
+    thermalPolicy->OnThermalLevelChanged(static_cast<int32_t>(level));
+    return true;
+}
+
+ThermalPolicy::ThermalPolicy(shared_ptr<WorkPolicyManager> workPolicyManager) : thermalLevel_(INVALID_THERMAL_LEVEL)
 {
     workPolicyManager_ = workPolicyManager;
 #ifdef PC_PLATFORM
@@ -47,6 +62,72 @@ ThermalPolicy::ThermalPolicy(shared_ptr<WorkPolicyManager> workPolicyManager)
 
 ThermalPolicy::~ThermalPolicy()
 {
+    Unsubscribe();
+}
+
+bool ThermalPolicy::Subscribe()
+{
+    std::lock_guard<ffrt::mutex> lock(callbackMutex_);
+    if (thermalLevelCallback_ != nullptr) {
+        return true;
+    }
+    sptr<ThermalLevelCallback> callback = new (std::nothrow) ThermalLevelCallback(weak_from_this());
+    if (callback == nullptr) {
+        WS_HILOGE("create thermal level callback failed");
+        return false;
+    }
+    if (!ThermalMgrClient::GetInstance().SubscribeThermalLevelCallback(callback)) {
+        WS_HILOGE("subscribe thermal level callback failed");
+        return false;
+    }
+    thermalLevelCallback_ = callback;
+    int32_t thermalLevel = static_cast<int32_t>(ThermalMgrClient::GetInstance().GetThermalLevel());
+    int32_t expected = INVALID_THERMAL_LEVEL;
+    thermalLevel_.compare_exchange_strong(expected, thermalLevel);
+    WS_HILOGI("subscribe thermal level callback success, thermalLevel: %{public}d", thermalLevel_.load());
+    return true;
+}
+
+void ThermalPolicy::Unsubscribe()
+{
+    std::lock_guard<ffrt::mutex> lock(callbackMutex_);
+    if (thermalLevelCallback_ == nullptr) {
+        return;
+    }
+    ThermalMgrClient::GetInstance().UnSubscribeThermalLevelCallback(thermalLevelCallback_);
+    thermalLevelCallback_ = nullptr;
+    thermalLevel_.store(INVALID_THERMAL_LEVEL);
+}
+
+void ThermalPolicy::OnServiceRemoved()
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(callbackMutex_);
+        if (thermalLevelCallback_ == nullptr) {
+            return;
+        }
+        // the callback died with the service, nothing is left to unsubscribe.
+        thermalLevelCallback_ = nullptr;
+        thermalLevel_.store(INVALID_THERMAL_LEVEL);
+    }
+    WS_HILOGI("thermal manager removed, poll the thermal level");
+    if (workPolicyManager_ != nullptr) {
+        workPolicyManager_->InvalidatePolicySamples();
+    }
+}
+
+void ThermalPolicy::OnThermalLevelChanged(int32_t thermalLevel)
+{
+    int32_t lastThermalLevel = thermalLevel_.exchange(thermalLevel);
+    if (lastThermalLevel == thermalLevel || workPolicyManager_ == nullptr) {
+        return;
+    }
+    WS_HILOGI("thermalLevel changed from %{public}d to %{public}d", lastThermalLevel, thermalLevel);
+    workPolicyManager_->InvalidatePolicySamples();
+    if (lastThermalLevel == INVALID_THERMAL_LEVEL ||
+        GetCurThermalLevelMaxRunning(thermalLevel) > GetCurThermalLevelMaxRunning(lastThermalLevel)) {
+        workPolicyManager_->SendRetrigger(0);
+    }
 }
 
 int32_t ThermalPolicy::GetThermalLevel()
@@ -58,6 +139,10 @@ int32_t ThermalPolicy::GetThermalLevel()
             return dumpThermalLevel;
         }
     }
+    int32_t pushedThermalLevel = thermalLevel_.load();
+    if (pushedThermalLevel != INVALID_THERMAL_LEVEL) {
+        return pushedThermalLevel;
+    }
     auto& thermalMgrClient = ThermalMgrClient::GetInstance();
     ThermalLevel thermalLevel = thermalMgrClient.GetThermalLevel();
     return static_cast<int32_t>(thermalLevel);
@@ -84,6 +169,12 @@ int32_t ThermalPolicy::GetPolicyMaxRunning(WorkSchedSystemPolicy& systemPolicy)
     WS_HILOGD("ThermalLevel:%{public}d, PolicyRes:%{public}d", thermalLevel, res);
     return res;
 }
+
+int64_t ThermalPolicy::GetSampleTtlMs()
+{
+    // a pushed level is read without ipc, sampling it would only delay the change.
+    return thermalLevel_.load() != INVALID_THERMAL_LEVEL ? 0 : THERMAL_SAMPLE_TTL_MS;
+}
 } // namespace WorkScheduler
 } // namespace OHOS
 #endif // POWERMGR_THERMAL_MANAGER_ENABLE
\ No newline at end of file
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "policy/weighted_policy.h"
+
+#include <algorithm>
+
+#include "work_sched_hilog.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+namespace {
+const std::string ENABLE_KEY = "enable";
+const std::string MAX_RUNNING_COUNT_KEY = "max_running_count";
+const std::string LIGHT_DURATION_KEY = "light_duration_ms";
+const std::string LIGHT_COST_KEY = "light_cost";
+const std::string HEAVY_DURATION_KEY = "heavy_duration_ms";
+const std::string HEAVY_COST_KEY = "heavy_cost";
+const std::string BUNDLE_COSTS_KEY = "bundle_costs";
+const std::string BUNDLE_NAME_KEY = "bundleName";
+const std::string COST_KEY = "cost";
+const int32_t MIN_WORK_COST = 1;
+const int32_t MAX_WORK_COST = MAX_RUNNING_COUNT * WORK_COST_UNIT;
+}
+
+WeightedPolicy::WeightedPolicy(const std::shared_ptr<WorkExecHistory> &execHistory) : execHistory_(execHistory) {}
+
+int32_t WeightedPolicy::GetCostFromJson(const nlohmann::json &root, const std::string &key, int32_t defaultCost)
+{
+    if (!root.contains(key) || !root[key].is_number_integer()) {
+        return defaultCost;
+    }
+    int64_t cost = std::clamp<int64_t>(root[key].get<int64_t>(), MIN_WORK_COST, MAX_WORK_COST);
+    return static_cast<int32_t>(cost);
+}
+
+bool WeightedPolicy::UpdateConfig(const nlohmann::json &root)
+{
+    if (!root.is_object()) {
+        WS_HILOGE("weighted policy config is not an object");
+        return false;
+    }
+    Config config;
+    if (root.contains(ENABLE_KEY) && root[ENABLE_KEY].is_boolean()) {
+        config.enable = root[ENABLE_KEY].get<bool>();
+    }
+    if (root.contains(MAX_RUNNING_COUNT_KEY) && root[MAX_RUNNING_COUNT_KEY].is_number_unsigned()) {
+        uint64_t maxRunningCount = root[MAX_RUNNING_COUNT_KEY].get<uint64_t>();
+        config.maxRunningCount = static_cast<int32_t>(std::clamp<uint64_t>(maxRunningCount, 1,
+            DUMP_SET_MAX_COUNT_LIMIT));
+    }
+    if (root.contains(LIGHT_DURATION_KEY) && root[LIGHT_DURATION_KEY].is_number_unsigned()) {
+        config.lightDurationMs = root[LIGHT_DURATION_KEY].get<uint64_t>();
+    }
+    config.lightCost = GetCostFromJson(root, LIGHT_COST_KEY, config.lightCost);
+    if (root.contains(HEAVY_DURATION_KEY) && root[HEAVY_DURATION_KEY].is_number_unsigned()) {
+        config.heavyDurationMs = root[HEAVY_DURATION_KEY].get<uint64_t>();
+    }
+    config.heavyCost = GetCostFromJson(root, HEAVY_COST_KEY, config.heavyCost);
+    if (root.contains(BUNDLE_COSTS_KEY) && root[BUNDLE_COSTS_KEY].is_array()) {
+        for (const auto &it : root[BUNDLE_COSTS_KEY]) {
+            if (!it.is_object() || !it.contains(BUNDLE_NAME_KEY) || !it[BUNDLE_NAME_KEY].is_string() ||
+                !it.contains(COST_KEY) || !it[COST_KEY].is_number_integer()) {
+                WS_HILOGE("bundle cost content is error");
+                continue;
+            }
+            config.bundleCosts[it[BUNDLE_NAME_KEY].get<std::string>()] =
+                GetCostFromJson(it, COST_KEY, WORK_COST_UNIT);
+        }
+    }
+    WS_HILOGI("weighted policy enable: %{public}d, maxRunningCount: %{public}d, lightCost: %{public}d, "
+        "heavyCost: %{public}d, bundle costs: %{public}zu", config.enable, config.maxRunningCount,
+        config.lightCost, config.heavyCost, config.bundleCosts.size());
+    std::unique_lock<ffrt::shared_mutex> lock(configMutex_);
+    config_ = std::move(config);
+    return true;
+}
+
+bool WeightedPolicy::IsEnabled()
+{
+    std::shared_lock<ffrt::shared_mutex> lock(configMutex_);
+    return config_.enable;
+}
+
+int32_t WeightedPolicy::GetWorkCost(const std::shared_ptr<WorkStatus> &workStatus)
+{
+    std::shared_lock<ffrt::shared_mutex> lock(configMutex_);
+    return GetWorkCostLocked(workStatus);
+}
+
+int32_t WeightedPolicy::GetWorkCostLocked(const std::shared_ptr<WorkStatus> &workStatus)
+{
+    if (!config_.enable || workStatus == nullptr) {
+        return WORK_COST_UNIT;
+    }
+    auto iter = config_.bundleCosts.find(workStatus->bundleName_);
+    if (iter != config_.bundleCosts.end()) {
+        return iter->second;
+    }
+    // duration_ is reset when a repeating work stops, the history keeps the runs.
+    WorkExecHistory::Record record;
+    if (execHistory_ == nullptr || !execHistory_->GetRecord(workStatus->workKey_, record) ||
+        record.durationMs == 0) {
+        return WORK_COST_UNIT;
+    }
+    uint64_t duration = record.durationMs;
+    if (config_.heavyDurationMs != 0 && duration >= config_.heavyDurationMs) {
+        return config_.heavyCost;
+    }
+    if (config_.lightDurationMs != 0 && duration <= config_.lightDurationMs) {
+        return config_.lightCost;
+    }
+    return WORK_COST_UNIT;
+}
+
+bool WeightedPolicy::CanRun(const std::shared_ptr<WorkStatus> &workStatus, int32_t allowRunningCount,
+    int32_t runningCount)
+{
+    std::shared_lock<ffrt::shared_mutex> lock(configMutex_);
+    if (!config_.enable) {
+        return runningCount < allowRunningCount;
+    }
+    if (allowRunningCount <= 0 || runningCount >= config_.maxRunningCount) {
+        return false;
+    }
+    // a work heavier than the whole budget still runs alone.
+    if (runningCount == 0) {
+        return true;
+    }
+    int32_t budget = allowRunningCount * WORK_COST_UNIT;
+    return WorkStatus::GetRunningCost() + GetWorkCostLocked(workStatus) <= budget;
+}
+
+void WeightedPolicy::Dump(std::string &result)
+{
+    std::shared_lock<ffrt::shared_mutex> lock(configMutex_);
+    result.append("enable: " + std::to_string(config_.enable) +
+        ", maxRunningCount: " + std::to_string(config_.maxRunningCount) +
+        ", runningCost: " + std::to_string(WorkStatus::GetRunningCost()) +
+        ", lightDurationMs: " + std::to_string(config_.lightDurationMs) +
+        ", lightCost: " + std::to_string(config_.lightCost) +
+        ", heavyDurationMs: " + std::to_string(config_.heavyDurationMs) +
+        ", heavyCost: " + std::to_string(config_.heavyCost) + "\n");
+    for (const auto &[bundleName, cost] : config_.bundleCosts) {
+        result.append("  " + bundleName + ": " + std::to_string(cost) + "\n");
+    }
+}
+} // namespace WorkScheduler
+} // namespace OHOS
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "system_state_snapshot.h"
+
+#include <atomic>
+
+namespace OHOS {
+namespace WorkScheduler {
+namespace {
+std::shared_ptr<const SystemStateSnapshot> g_currentSnapshot = nullptr;
+}
+
+SystemStateSnapshot::SystemStateSnapshot(const std::shared_ptr<const SystemStateSnapshot> &previous,
+    WorkCondition::Type type, const std::shared_ptr<Condition> &value)
+{
+    if (previous) {
+        version_ = previous->version_;
+        typeVersion_ = previous->typeVersion_;
+        conditions_ = previous->conditions_;
+    }
+    version_++;
+    if (!IsSystemState(type)) {
+        return;
+    }
+    conditions_.Set(type, value);
+    typeVersion_[type] = version_;
+}
+
+bool SystemStateSnapshot::IsSystemState(WorkCondition::Type type)
+{
+    switch (type) {
+        case WorkCondition::Type::NETWORK:
+        case WorkCondition::Type::CHARGER:
+        case WorkCondition::Type::BATTERY_STATUS:
+        case WorkCondition::Type::BATTERY_LEVEL:
+        case WorkCondition::Type::STORAGE:
+        case WorkCondition::Type::DEEP_IDLE:
+        case WorkCondition::Type::STANDBY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::shared_ptr<const SystemStateSnapshot> SystemStateSnapshot::GetCurrent()
+{
+    return std::atomic_load(&g_currentSnapshot);
+}
+
+void SystemStateSnapshot::Publish(const std::shared_ptr<const SystemStateSnapshot> &snapshot)
+{
+    std::atomic_store(&g_currentSnapshot, snapshot);
+}
+
+uint32_t SystemStateSnapshot::GetChangedMask(uint64_t version) const
+{
+    uint32_t changedMask = 0;
+    for (uint32_t type = 0; type < ConditionSlots::SLOT_COUNT; type++) {
+        if (typeVersion_[type] > version) {
+            changedMask |= ConditionSlots::TypeBit(static_cast<int32_t>(type));
+        }
+    }
+    return changedMask;
+}
+} // namespace WorkScheduler
+} // namespace OHOS
@@ -42,35 +42,36 @@ namespace OHOS {
 namespace WorkScheduler {
 const std::string PARAM_APP_CLONE_INDEX_KEY = "ohos.extra.param.key.appCloneIndex";
 
-void WorkConnManager::AddConnInfo(const string &workId, sptr<WorkSchedulerConnection> &connection)
+void WorkConnManager::AddConnInfo(const WorkKey &workKey, sptr<WorkSchedulerConnection> &connection)
 {
     std::lock_guard<ffrt::mutex> lock(connMapMutex_);
-    connMap_.emplace(workId, connection);
+    connMap_.emplace(workKey, connection);
 }
 
-void WorkConnManager::RemoveConnInfo(const string &workId)
+void WorkConnManager::RemoveConnInfo(const WorkKey &workKey)
 {
     std::lock_guard<ffrt::mutex> lock(connMapMutex_);
-    connMap_.erase(workId);
+    connMap_.erase(workKey);
 }
 
-sptr<WorkSchedulerConnection> WorkConnManager::GetConnInfo(const string &workId)
+sptr<WorkSchedulerConnection> WorkConnManager::GetConnInfo(const WorkKey &workKey)
 {
     std::lock_guard<ffrt::mutex> lock(connMapMutex_);
-    if (connMap_.count(workId) > 0) {
-        return connMap_.at(workId);
+    auto iter = connMap_.find(workKey);
+    if (iter != connMap_.end()) {
+        return iter->second;
     }
     return nullptr;
 }
 
 bool WorkConnManager::StartWork(shared_ptr<WorkStatus> workStatus)
 {
-    sptr<WorkSchedulerConnection> conn = GetConnInfo(workStatus->workId_);
+    sptr<WorkSchedulerConnection> conn = GetConnInfo(workStatus->workKey_);
     if (conn) {
         WS_HILOGE("Work has started with id: %{public}s, bundleName: %{public}s, abilityName: %{public}s",
             workStatus->workId_.c_str(), workStatus->bundleName_.c_str(), workStatus->abilityName_.c_str());
         WorkSchedUtil::HiSysEventException(EventErrorCode::CONNECT_ABILITY, "connect info has existed, connect failed");
-        RemoveConnInfo(workStatus->workId_);
+        RemoveConnInfo(workStatus->workKey_);
         if (conn->IsConnected()) {
             conn->StopWork();
             DisConnect(conn);
@@ -107,7 +108,7 @@ bool WorkConnManager::StartWork(shared_ptr<WorkStatus> workStatus)
             std::to_string(ret));
         return false;
     }
-    AddConnInfo(workStatus->workId_, connection);
+    AddConnInfo(workStatus->workKey_, connection);
 
     // Notify work add event to battery statistics
     WriteStartWorkEvent(workStatus);
@@ -133,7 +134,7 @@ bool WorkConnManager::DisConnect(sptr<WorkSchedulerConnection> connect)
 
 bool WorkConnManager::StopWork(shared_ptr<WorkStatus> workStatus, bool isTimeOut)
 {
-    sptr<WorkSchedulerConnection> conn = GetConnInfo(workStatus->workId_);
+    sptr<WorkSchedulerConnection> conn = GetConnInfo(workStatus->workKey_);
     if (!conn) {
         WS_HILOGE("%{public}s %{public}d connection is null", workStatus->workId_.c_str(), isTimeOut);
         return false;
@@ -157,7 +158,7 @@ bool WorkConnManager::StopWork(shared_ptr<WorkStatus> workStatus, bool isTimeOut
         WS_HILOGI("OnWorkStop uid:%{public}d bundleName:%{public}s workId:%{public}s duration:%{public}" PRIu64
             ", startTime:%{public}" PRIu64, workStatus->uid_, workStatus->bundleName_.c_str(),
             workStatus->workId_.c_str(), workStatus->duration_, workStatus->workStartTime_);
-        RemoveConnInfo(workStatus->workId_);
+        RemoveConnInfo(workStatus->workKey_);
 #ifdef DEVICE_STANDBY_ENABLE
         DevStandbyMgr::StandbyServiceClient::GetInstance().ReportWorkSchedulerStatus(false,
             workStatus->uid_, workStatus->bundleName_);
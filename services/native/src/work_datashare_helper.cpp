@@ -25,6 +25,7 @@ const std::string SETTING_COLUMN_KEYWORD = "KEYWORD";
 const std::string SETTING_COLUMN_VALUE = "VALUE";
 const std::string SETTING_URI_PROXY = "datashare:///com.ohos.settingsdata/entry/settingsdata/SETTINGSDATA?Proxy=true";
 constexpr const char *SETTINGS_DATA_EXT_URI = "datashare:///com.ohos.settingsdata.DataAbility";
+const std::string SWITCH_ON = "1";
 }
 
 WorkDatashareHelper::~WorkDatashareHelper() { }
@@ -35,9 +36,17 @@ WorkDatashareHelper& WorkDatashareHelper::GetInstance()
     return workDatashareHelper;
 }
 
-__attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::GetStringValue(const std::string& key, std::string& value)
+bool WorkDatashareHelper::GetStringValue(const std::string& key, std::string& value)
 {
-    auto helper = CreateDataShareHelper();
+    bool found = false;
+    return QueryStringValue(key, value, found) && found;
+}
+
+__attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::QueryStringValue(const std::string& key,
+    std::string& value, bool& found)
+{
+    found = false;
+    auto helper = GetDataShareHelper();
     if (helper == nullptr) {
         return false;
     }
@@ -46,7 +55,6 @@ __attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::GetStringValue(con
     predicates.EqualTo(SETTING_COLUMN_KEYWORD, key);
     Uri uri(SETTING_URI_PROXY + "&key=" + key);
     auto resultSet = helper->Query(uri, predicates, columns);
-    ReleaseDataShareHelper(helper);
     if (resultSet == nullptr) {
         WS_HILOGE("helper->Query return nullptr");
         return false;
@@ -56,7 +64,7 @@ __attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::GetStringValue(con
     if (count == 0) {
         WS_HILOGW("not found value, key=%{public}s, count=%{public}d", key.c_str(), count);
         resultSet->Close();
-        return false;
+        return true;
     }
     const int32_t INDEX = 0;
     resultSet->GoToRow(INDEX);
@@ -67,9 +75,213 @@ __attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::GetStringValue(con
         return false;
     }
     resultSet->Close();
+    found = true;
     return true;
 }
 
+__attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::GetStringValues(const std::vector<std::string>& keys,
+    std::unordered_map<std::string, std::string>& values)
+{
+    if (keys.empty()) {
+        return true;
+    }
+    auto helper = GetDataShareHelper();
+    if (helper == nullptr) {
+        return false;
+    }
+    std::vector<std::string> columns = {SETTING_COLUMN_KEYWORD, SETTING_COLUMN_VALUE};
+    DataShare::DataSharePredicates predicates;
+    predicates.In(SETTING_COLUMN_KEYWORD, keys);
+    Uri uri(SETTING_URI_PROXY);
+    auto resultSet = helper->Query(uri, predicates, columns);
+    if (resultSet == nullptr) {
+        WS_HILOGE("helper->Query return nullptr");
+        return false;
+    }
+    int32_t count = 0;
+    resultSet->GetRowCount(count);
+    const int32_t KEYWORD_INDEX = 0;
+    const int32_t VALUE_INDEX = 1;
+    for (int32_t row = 0; row < count; row++) {
+        std::string key;
+        std::string value;
+        if (resultSet->GoToRow(row) != DataShare::E_OK ||
+            resultSet->GetString(KEYWORD_INDEX, key) != DataShare::E_OK ||
+            resultSet->GetString(VALUE_INDEX, value) != DataShare::E_OK) {
+            WS_HILOGW("read row fail, row=%{public}d", row);
+            continue;
+        }
+        values[key] = value;
+    }
+    resultSet->Close();
+    WS_HILOGD("query %{public}zu keys, found %{public}zu", keys.size(), values.size());
+    return true;
+}
+
+bool WorkDatashareHelper::IsSwitchOn(const std::string& key)
+{
+    uint64_t changeSeq = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        auto iter = switchCache_.find(key);
+        if (iter != switchCache_.end()) {
+            return iter->second->load();
+        }
+        changeSeq = switchChangeSeq_;
+    }
+    // observe before the query, so a change between them is not missed.
+    bool observed = ObserveSwitch(key);
+    std::string value;
+    bool found = false;
+    if (!QueryStringValue(key, value, found)) {
+        // not cached, the next call queries again.
+        return false;
+    }
+    bool isOn = found && value == SWITCH_ON;
+    std::lock_guard<ffrt::mutex> lock(switchMutex_);
+    // a change notified during the query may not be in the value, leave it to the next call.
+    if (observed && changeSeq == switchChangeSeq_) {
+        switchCache_.emplace(key, std::make_shared<std::atomic<bool>>(isOn));
+    }
+    return isOn;
+}
+
+void WorkDatashareHelper::PreloadSwitches(const std::vector<std::string>& keys)
+{
+    std::vector<std::string> uncachedKeys;
+    uint64_t changeSeq = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        for (const auto& key : keys) {
+            if (switchCache_.count(key) == 0) {
+                uncachedKeys.emplace_back(key);
+            }
+        }
+        changeSeq = switchChangeSeq_;
+    }
+    std::vector<std::string> observedKeys;
+    for (const auto& key : uncachedKeys) {
+        if (ObserveSwitch(key)) {
+            observedKeys.emplace_back(key);
+        }
+    }
+    std::unordered_map<std::string, std::string> values;
+    if (!GetStringValues(observedKeys, values)) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(switchMutex_);
+    if (changeSeq != switchChangeSeq_) {
+        WS_HILOGI("switch changed during preload, query on use");
+        return;
+    }
+    for (const auto& key : observedKeys) {
+        auto valueIter = values.find(key);
+        bool isOn = valueIter != values.end() && valueIter->second == SWITCH_ON;
+        switchCache_.emplace(key, std::make_shared<std::atomic<bool>>(isOn));
+    }
+    WS_HILOGI("preload %{public}zu switches", observedKeys.size());
+}
+
+void WorkDatashareHelper::SetSwitchChangedCallback(const std::function<void(const std::string&)>& callback)
+{
+    std::lock_guard<ffrt::mutex> lock(switchMutex_);
+    switchChangedCallback_ = callback;
+}
+
+void WorkDatashareHelper::OnSwitchChanged(const std::string& key)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        switchChangeSeq_++;
+    }
+    std::string value;
+    bool found = false;
+    bool isQueried = QueryStringValue(key, value, found);
+    bool isOn = isQueried && found && value == SWITCH_ON;
+    std::function<void(const std::string&)> callback;
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        auto iter = switchCache_.find(key);
+        if (!isQueried) {
+            // drop the cached value, IsSwitchOn queries again when the works are judged.
+            WS_HILOGW("query changed switch fail, key=%{public}s", key.c_str());
+            switchCache_.erase(key);
+        } else if (iter == switchCache_.end()) {
+            switchCache_.emplace(key, std::make_shared<std::atomic<bool>>(isOn));
+        } else if (iter->second->exchange(isOn) == isOn) {
+            return;
+        }
+        callback = switchChangedCallback_;
+    }
+    WS_HILOGI("switch changed, key=%{public}s, isQueried=%{public}d, isOn=%{public}d", key.c_str(), isQueried, isOn);
+    if (callback) {
+        callback(key);
+    }
+}
+
+void WorkDatashareHelper::OnRemoteDied()
+{
+    WS_HILOGI("data share service died, reset helper");
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        switchObservers_.clear();
+        switchCache_.clear();
+    }
+    std::lock_guard<ffrt::mutex> lock(helperMutex_);
+    if (helper_ != nullptr) {
+        ReleaseDataShareHelper(helper_);
+        helper_ = nullptr;
+    }
+}
+
+void WorkDatashareHelper::SwitchObserver::OnChange()
+{
+    WorkDatashareHelper::GetInstance().OnSwitchChanged(key_);
+}
+
+__attribute__((no_sanitize("cfi"))) bool WorkDatashareHelper::ObserveSwitch(const std::string& key)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        if (switchObservers_.count(key) > 0) {
+            return true;
+        }
+    }
+    auto helper = GetDataShareHelper();
+    if (helper == nullptr) {
+        return false;
+    }
+    sptr<SwitchObserver> observer = new (std::nothrow) SwitchObserver(key);
+    if (observer == nullptr) {
+        return false;
+    }
+    Uri uri(SETTING_URI_PROXY + "&key=" + key);
+    int32_t ret = helper->RegisterObserver(uri, observer);
+    if (ret != DataShare::E_OK) {
+        WS_HILOGW("register observer fail, key=%{public}s, ret=%{public}d", key.c_str(), ret);
+        return false;
+    }
+    bool inserted = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(switchMutex_);
+        inserted = switchObservers_.emplace(key, observer).second;
+    }
+    if (!inserted) {
+        // another caller registered the key meanwhile, keep only its observer.
+        helper->UnregisterObserver(uri, observer);
+    }
+    return true;
+}
+
+std::shared_ptr<DataShare::DataShareHelper> WorkDatashareHelper::GetDataShareHelper()
+{
+    std::lock_guard<ffrt::mutex> lock(helperMutex_);
+    if (helper_ == nullptr) {
+        helper_ = CreateDataShareHelper();
+    }
+    return helper_;
+}
+
 std::shared_ptr<DataShare::DataShareHelper> WorkDatashareHelper::CreateDataShareHelper()
 {
     auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
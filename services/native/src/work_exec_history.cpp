@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "work_exec_history.h"
+
+#include <algorithm>
+
+#include "work_lock_order.h"
+#include "work_sched_hilog.h"
+
+namespace OHOS {
+namespace WorkScheduler {
+namespace {
+const std::string EXEC_HISTORIES_KEY = "exec_histories";
+const std::string BUNDLE_NAME_KEY = "bundleName";
+const std::string WORK_ID_KEY = "workId";
+const std::string DURATION_KEY = "durationMs";
+const std::string TIMEOUT_RATE_KEY = "timeoutRate";
+const std::string LAST_DURATION_KEY = "lastDurationMs";
+const std::string RUN_COUNT_KEY = "runCount";
+const uint32_t PER_MILLE = 1000;
+// a new sample weighs 1/4 of the average.
+const uint64_t EWMA_OLD_WEIGHT = 3;
+const uint64_t EWMA_TOTAL_WEIGHT = 4;
+// a work that always times out ranks as if it ran 4 times longer.
+const uint64_t TIMEOUT_PENALTY = 3;
+const uint64_t PERSIST_INTERVAL_MS = 10 * 60 * 1000;
+const int32_t JSON_INDENT_WIDTH = 4;
+
+uint64_t Ewma(uint64_t average, uint64_t sample)
+{
+    return (average * EWMA_OLD_WEIGHT + sample) / EWMA_TOTAL_WEIGHT;
+}
+
+bool GetUint64(const nlohmann::json &root, const std::string &key, uint64_t &value)
+{
+    if (!root.contains(key) || !root[key].is_number_unsigned()) {
+        return false;
+    }
+    value = root[key].get<uint64_t>();
+    return true;
+}
+}
+
+WorkExecHistory::WorkExecHistory(size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+WorkExecHistory::Entry &WorkExecHistory::TouchLocked(const WorkKey &workKey, const std::string &bundleName)
+{
+    auto iter = index_.find(workKey);
+    if (iter != index_.end()) {
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        return entries_.front();
+    }
+    if (entries_.size() >= capacity_) {
+        const Entry &oldest = entries_.back();
+        index_.erase(oldest.workKey);
+        entries_.pop_back();
+    }
+    entries_.push_front({workKey, bundleName, Record()});
+    index_.emplace(workKey, entries_.begin());
+    return entries_.front();
+}
+
+void WorkExecHistory::OnWorkStop(const std::shared_ptr<WorkStatus> &workStatus, uint64_t durationMs,
+    bool isTimeOut)
+{
+    if (workStatus == nullptr) {
+        return;
+    }
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    Record &record = TouchLocked(workStatus->workKey_, workStatus->bundleName_).record;
+    uint64_t timeoutSample = isTimeOut ? PER_MILLE : 0;
+    if (record.runCount == 0) {
+        record.durationMs = durationMs;
+        record.timeoutRate = static_cast<uint32_t>(timeoutSample);
+    } else {
+        record.durationMs = Ewma(record.durationMs, durationMs);
+        record.timeoutRate = static_cast<uint32_t>(Ewma(record.timeoutRate, timeoutSample));
+    }
+    record.lastDurationMs = durationMs;
+    if (record.runCount < UINT32_MAX) {
+        record.runCount++;
+    }
+    changeSeq_++;
+}
+
+bool WorkExecHistory::GetRecord(const WorkKey &workKey, Record &record)
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    auto iter = index_.find(workKey);
+    if (iter == index_.end()) {
+        return false;
+    }
+    record = iter->second->record;
+    return true;
+}
+
+uint64_t WorkExecHistory::GetRank(const std::shared_ptr<WorkStatus> &workStatus)
+{
+    Record record;
+    if (workStatus == nullptr || !GetRecord(workStatus->workKey_, record)) {
+        // a work without history is tried first so that it gets one.
+        return 0;
+    }
+    return record.durationMs * (PER_MILLE + TIMEOUT_PENALTY * record.timeoutRate) / PER_MILLE;
+}
+
+void WorkExecHistory::RemoveByUid(int32_t uid)
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+        if (iter->workKey.uid != uid) {
+            ++iter;
+            continue;
+        }
+        index_.erase(iter->workKey);
+        iter = entries_.erase(iter);
+        changeSeq_++;
+    }
+}
+
+bool WorkExecHistory::NeedPersist(uint64_t now, uint64_t &delayMs)
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    if (changeSeq_ == persistedSeq_ || persistPending_) {
+        return false;
+    }
+    persistPending_ = true;
+    // persisted at once the first time, then at most once per interval.
+    if (lastPersistTime_ == 0 || now < lastPersistTime_ || now - lastPersistTime_ >= PERSIST_INTERVAL_MS) {
+        delayMs = 0;
+    } else {
+        delayMs = PERSIST_INTERVAL_MS - (now - lastPersistTime_);
+    }
+    return true;
+}
+
+bool WorkExecHistory::IsDirty()
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    return changeSeq_ != persistedSeq_;
+}
+
+bool WorkExecHistory::ParseFromJson(const nlohmann::json &root)
+{
+    if (!root.is_object() || !root.contains(EXEC_HISTORIES_KEY) || !root[EXEC_HISTORIES_KEY].is_array()) {
+        WS_HILOGE("exec history content is error");
+        return false;
+    }
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    entries_.clear();
+    index_.clear();
+    // persisted from the least recently run, so the last one ends up in front.
+    for (const auto &it : root[EXEC_HISTORIES_KEY]) {
+        if (!it.is_object() || !it.contains(BUNDLE_NAME_KEY) || !it[BUNDLE_NAME_KEY].is_string() ||
+            !it.contains(WORK_ID_KEY) || !it[WORK_ID_KEY].is_string()) {
+            WS_HILOGE("exec history record is error");
+            continue;
+        }
+        uint64_t duration = 0;
+        uint64_t timeoutRate = 0;
+        uint64_t lastDuration = 0;
+        uint64_t runCount = 0;
+        if (!GetUint64(it, DURATION_KEY, duration) || !GetUint64(it, TIMEOUT_RATE_KEY, timeoutRate) ||
+            !GetUint64(it, LAST_DURATION_KEY, lastDuration) || !GetUint64(it, RUN_COUNT_KEY, runCount)) {
+            WS_HILOGE("exec history record value is error");
+            continue;
+        }
+        WorkKey workKey;
+        if (!WorkKey::FromString(it[WORK_ID_KEY].get<std::string>(), workKey)) {
+            WS_HILOGE("exec history workId is error");
+            continue;
+        }
+        Record &record = TouchLocked(workKey, it[BUNDLE_NAME_KEY].get<std::string>()).record;
+        record.durationMs = duration;
+        record.timeoutRate = static_cast<uint32_t>(std::min<uint64_t>(timeoutRate, PER_MILLE));
+        record.lastDurationMs = lastDuration;
+        record.runCount = static_cast<uint32_t>(std::min<uint64_t>(runCount, UINT32_MAX));
+    }
+    persistedSeq_ = changeSeq_;
+    WS_HILOGI("exec history restored, size: %{public}zu", entries_.size());
+    return true;
+}
+
+std::string WorkExecHistory::ParseToJsonStr(uint64_t &seq)
+{
+    nlohmann::json root = nlohmann::json::object();
+    nlohmann::json histories = nlohmann::json::array();
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    for (auto iter = entries_.rbegin(); iter != entries_.rend(); ++iter) {
+        nlohmann::json history;
+        history[BUNDLE_NAME_KEY] = iter->bundleName;
+        history[WORK_ID_KEY] = iter->workKey.ToString();
+        history[DURATION_KEY] = iter->record.durationMs;
+        history[TIMEOUT_RATE_KEY] = iter->record.timeoutRate;
+        history[LAST_DURATION_KEY] = iter->record.lastDurationMs;
+        history[RUN_COUNT_KEY] = iter->record.runCount;
+        histories.push_back(history);
+    }
+    root[EXEC_HISTORIES_KEY] = histories;
+    seq = changeSeq_;
+    return root.dump(JSON_INDENT_WIDTH, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+void WorkExecHistory::OnPersisted(uint64_t seq, bool isSuccess, uint64_t now)
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    persistPending_ = false;
+    // a failed write is retried no sooner than a successful one.
+    lastPersistTime_ = now;
+    if (isSuccess && seq > persistedSeq_) {
+        persistedSeq_ = seq;
+    }
+}
+
+void WorkExecHistory::Dump(std::string &result)
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::WORK_EXEC_HISTORY);
+    result.append("size: " + std::to_string(entries_.size()) + ", capacity: " + std::to_string(capacity_) + "\n");
+    for (const auto &entry : entries_) {
+        result.append("  " + entry.bundleName + " " + entry.workKey.ToString() +
+            ": durationMs: " + std::to_string(entry.record.durationMs) +
+            ", timeoutRate: " + std::to_string(entry.record.timeoutRate) +
+            ", lastDurationMs: " + std::to_string(entry.record.lastDurationMs) +
+            ", runCount: " + std::to_string(entry.record.runCount) + "\n");
+    }
+}
+} // namespace WorkScheduler
+} // namespace OHOS
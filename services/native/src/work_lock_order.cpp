@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "work_lock_order.h"
+
+#ifdef WORK_SCHED_LOCK_ORDER_CHECK
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ffrt.h"
+#include "work_sched_hilog.h"
+#endif
+
+namespace OHOS {
+namespace WorkScheduler {
+#ifdef WORK_SCHED_LOCK_ORDER_CHECK
+namespace {
+using HeldLevels = std::vector<LockLevel>;
+// an ffrt task may resume on another worker thread after it waited for a lock, so its levels follow the task id.
+std::mutex g_taskHeldLevelsMutex;
+std::unordered_map<uint64_t, HeldLevels> g_taskHeldLevels;
+// levels of a thread outside any ffrt task.
+thread_local HeldLevels g_threadHeldLevels;
+
+template<typename Visitor>
+void VisitHeldLevels(const Visitor &visitor)
+{
+    uint64_t taskId = ffrt::this_task::get_id();
+    if (taskId == 0) {
+        visitor(g_threadHeldLevels);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_taskHeldLevelsMutex);
+    HeldLevels &heldLevels = g_taskHeldLevels[taskId];
+    visitor(heldLevels);
+    if (heldLevels.empty()) {
+        g_taskHeldLevels.erase(taskId);
+    }
+}
+}
+
+void LockOrderChecker::OnAcquire(LockLevel level)
+{
+    VisitHeldLevels([level](HeldLevels &heldLevels) {
+        if (!heldLevels.empty() && level <= heldLevels.back()) {
+            WS_HILOGE("lock order violated, take level %{public}d while holding level %{public}d",
+                static_cast<int32_t>(level), static_cast<int32_t>(heldLevels.back()));
+            std::abort();
+        }
+        heldLevels.push_back(level);
+    });
+}
+
+void LockOrderChecker::OnRelease(LockLevel level)
+{
+    VisitHeldLevels([level](HeldLevels &heldLevels) {
+        auto iter = std::find(heldLevels.rbegin(), heldLevels.rend(), level);
+        if (iter != heldLevels.rend()) {
+            heldLevels.erase(std::next(iter).base());
+        }
+    });
+}
+#endif
+} // namespace WorkScheduler
+} // namespace OHOS
@@ -26,11 +26,13 @@
 #include "policy/app_data_clear_listener.h"
 #include "work_scheduler_service.h"
 #include "work_event_handler.h"
+#include "work_lock_order.h"
 #include "work_sched_hilog.h"
 #include "work_sched_errors.h"
 #include "work_sched_utils.h"
 #include "watchdog.h"
 #include "work_sched_data_manager.h"
+#include "work_sched_config.h"
 #include "work_sched_hisysevent_report.h"
 #include <cinttypes>
 
@@ -40,10 +42,16 @@ using namespace OHOS::HiviewDFX;
 
 namespace OHOS {
 namespace WorkScheduler {
+namespace {
+// the ready works are ranked by their execution history when at most this many slots are left.
+const int32_t SCARCE_SLOT_COUNT = 1;
+}
 
 WorkPolicyManager::WorkPolicyManager(const std::shared_ptr<WorkSchedulerService>& wss) : wss_(wss)
 {
     conditionReadyQueue_ = std::make_shared<WorkQueue>();
+    execHistory_ = std::make_shared<WorkExecHistory>();
+    weightedPolicy_ = std::make_shared<WeightedPolicy>(execHistory_);
     watchdogId_ = INIT_WATCHDOG_ID;
     dumpSetMemory_ = INIT_DUMP_SET_MEMORY;
     watchdogTime_.store(WATCHDOG_TIME);
@@ -75,7 +83,26 @@ bool WorkPolicyManager::Init(const std::shared_ptr<AppExecFwk::EventRunner>& run
 
 void WorkPolicyManager::AddPolicyFilter(shared_ptr<IPolicyFilter> filter)
 {
-    policyFilters_.emplace_back(filter);
+    policyFilters_.emplace_back(make_shared<PolicySampler>(filter));
+}
+
+void WorkPolicyManager::InvalidatePolicySamples()
+{
+    for (auto policyFilter : policyFilters_) {
+        policyFilter->Invalidate();
+    }
+}
+
+void WorkPolicyManager::UpdateWeightedPolicyConfig(const nlohmann::json &root)
+{
+    if (weightedPolicy_->UpdateConfig(root)) {
+        SendRetrigger(0);
+    }
+}
+
+std::shared_ptr<WorkExecHistory> WorkPolicyManager::GetExecHistory()
+{
+    return execHistory_;
 }
 
 void WorkPolicyManager::AddAppDataClearListener(std::shared_ptr<AppDataClearListener> listener)
@@ -124,16 +151,17 @@ std::string WorkPolicyManager::GetConditionString(const shared_ptr<WorkStatus> w
 int32_t WorkPolicyManager::AddWork(shared_ptr<WorkStatus> workStatus, int32_t uid)
 {
     WS_HILOGD("Add work");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    if (uidQueueMap_.count(uid) > 0) {
-        if (uidQueueMap_.at(uid)->Contains(make_shared<string>(workStatus->workId_))) {
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
+    auto iter = uidQueueMap_.find(uid);
+    if (iter != uidQueueMap_.end()) {
+        if (iter->second->Contains(workStatus->workKey_)) {
             WS_HILOGD("Workid has been added, should remove first.");
             return E_ADD_REPEAT_WORK_ERR;
-        } else if (uidQueueMap_.at(uid)->GetSize() >= MAX_WORK_COUNT_PER_UID) {
+        } else if (iter->second->GetSize() >= MAX_WORK_COUNT_PER_UID) {
             WS_HILOGE("each uid only can be added %{public}u works", MAX_WORK_COUNT_PER_UID);
             return E_WORK_EXCEED_UPPER_LIMIT;
         }
-        uidQueueMap_.at(uid)->Push(workStatus);
+        iter->second->Push(workStatus);
     } else {
         WS_HILOGD("uidQueue(%{public}d) not exists, create", uid);
         uidQueueMap_.emplace(uid, make_shared<WorkQueue>());
@@ -160,7 +188,7 @@ bool WorkPolicyManager::RemoveWork(shared_ptr<WorkStatus> workStatus, int32_t ui
 {
     WS_HILOGD("Remove work.");
     bool ret = false;
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     if (uidQueueMap_.count(uid) > 0) {
         WS_HILOGD("Remove workStatus ID: %{public}s form uidQueue(%{public}d)", workStatus->workId_.c_str(), uid);
         ret = uidQueueMap_.at(uid)->Remove(workStatus);
@@ -174,9 +202,10 @@ bool WorkPolicyManager::RemoveWork(shared_ptr<WorkStatus> workStatus, int32_t ui
 shared_ptr<WorkStatus> WorkPolicyManager::FindWorkStatus(WorkInfo& workInfo, int32_t uid)
 {
     WS_HILOGD("Find work status start.");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    if (uidQueueMap_.count(uid) > 0) {
-        return uidQueueMap_.at(uid)->Find(WorkStatus::MakeWorkId(workInfo.GetWorkId(), uid));
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
+    auto iter = uidQueueMap_.find(uid);
+    if (iter != uidQueueMap_.end()) {
+        return iter->second->Find(WorkStatus::MakeWorkKey(workInfo.GetWorkId(), uid));
     }
     return nullptr;
 }
@@ -184,9 +213,10 @@ shared_ptr<WorkStatus> WorkPolicyManager::FindWorkStatus(WorkInfo& workInfo, int
 shared_ptr<WorkStatus> WorkPolicyManager::FindWorkStatus(int32_t uId, int32_t workId)
 {
     WS_HILOGD("Find work status start.");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    if (uidQueueMap_.count(uId) > 0) {
-        return uidQueueMap_.at(uId)->Find(WorkStatus::MakeWorkId(workId, uId));
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
+    auto iter = uidQueueMap_.find(uId);
+    if (iter != uidQueueMap_.end()) {
+        return iter->second->Find(WorkStatus::MakeWorkKey(workId, uId));
     }
     return nullptr;
 }
@@ -194,7 +224,7 @@ shared_ptr<WorkStatus> WorkPolicyManager::FindWorkStatus(int32_t uId, int32_t wo
 shared_ptr<WorkStatus> WorkPolicyManager::FindSA(int32_t saId, int32_t uid)
 {
     WS_HILOGD("Find SA, saId:%{public}d, uid:%{public}d", saId, uid);
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     if (uidQueueMap_.count(uid) > 0) {
         return uidQueueMap_.at(uid)->FindSA(saId);
     }
@@ -203,11 +233,12 @@ shared_ptr<WorkStatus> WorkPolicyManager::FindSA(int32_t saId, int32_t uid)
 
 void WorkPolicyManager::RemoveFromUidQueue(std::shared_ptr<WorkStatus> workStatus, int32_t uid)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    if (uidQueueMap_.count(uid) > 0) {
-        uidQueueMap_.at(uid)->CancelWork(workStatus);
-        if (uidQueueMap_.at(uid)->GetSize() <= 0) {
-            uidQueueMap_.erase(uid);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
+    auto iter = uidQueueMap_.find(uid);
+    if (iter != uidQueueMap_.end()) {
+        iter->second->CancelWork(workStatus);
+        if (iter->second->GetSize() <= 0) {
+            uidQueueMap_.erase(iter);
         }
     }
 }
@@ -217,6 +248,31 @@ void WorkPolicyManager::RemoveFromReadyQueue(std::shared_ptr<WorkStatus> workSta
     conditionReadyQueue_->RemoveUnReady();
 }
 
+void WorkPolicyManager::PostRefreshExecHistory()
+{
+    auto service = wss_.lock();
+    if (service == nullptr) {
+        WS_HILOGE("wss_ lock failed");
+        return;
+    }
+    auto handler = service->GetHandler();
+    if (handler == nullptr) {
+        WS_HILOGE("handler is null");
+        return;
+    }
+    uint64_t delayMs = 0;
+    if (!execHistory_->NeedPersist(WorkSchedUtils::GetCurrentTimeMs(), delayMs)) {
+        return;
+    }
+    std::weak_ptr<WorkSchedulerService> weakService = service;
+    handler->PostTask([weakService]() {
+        auto service = weakService.lock();
+        if (service != nullptr) {
+            service->RefreshExecHistory();
+        }
+    }, static_cast<int64_t>(delayMs));
+}
+
 std::pair<bool, bool> WorkPolicyManager::StopWork(std::shared_ptr<WorkStatus> workStatus, int32_t uid,
     const bool needCancel, bool isTimeOut)
 {
@@ -229,6 +285,8 @@ std::pair<bool, bool> WorkPolicyManager::StopWork(std::shared_ptr<WorkStatus> wo
         } else {
             return {stopWorkSuccess, hasCanceled};
         }
+        execHistory_->OnWorkStop(workStatus, workStatus->duration_, isTimeOut);
+        PostRefreshExecHistory();
         if (!workStatus->IsRepeating()) {
             workStatus->MarkStatus(WorkStatus::Status::REMOVED);
             RemoveFromUidQueue(workStatus, uid);
@@ -259,21 +317,28 @@ std::pair<bool, bool> WorkPolicyManager::StopWork(std::shared_ptr<WorkStatus> wo
 bool WorkPolicyManager::StopAndClearWorks(int32_t uid)
 {
     WS_HILOGD("enter");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    auto iter = uidQueueMap_.find(uid);
-    if (iter != uidQueueMap_.end()) {
-        auto queue = iter->second;
-        if (!queue) {
-            WS_HILOGE("StopAndClearWorks failed, queue is nullptr");
-            return false;
+    shared_ptr<WorkQueue> queue;
+    {
+        OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
+        auto iter = uidQueueMap_.find(uid);
+        if (iter != uidQueueMap_.end()) {
+            if (!iter->second) {
+                WS_HILOGE("StopAndClearWorks failed, queue is nullptr");
+                return false;
+            }
+            queue = iter->second;
+            uidQueueMap_.erase(iter);
         }
-        for (auto it : queue->GetWorkList()) {
+    }
+    // the queue is out of uidQueueMap_ now, its works are stopped without holding the uid lock.
+    if (queue) {
+        auto works = queue->GetSnapshot();
+        for (const auto &it : *works) {
             workConnManager_->StopWork(it, false);
             it->MarkStatus(WorkStatus::Status::REMOVED);
             RemoveFromReadyQueue(it);
         }
         queue->ClearAll();
-        uidQueueMap_.erase(uid);
     }
     CheckWorkToRun();
     return true;
@@ -281,15 +346,15 @@ bool WorkPolicyManager::StopAndClearWorks(int32_t uid)
 
 int32_t WorkPolicyManager::IsLastWorkTimeout(int32_t workId, int32_t uid, bool &result)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    string workIdStr = WorkStatus::MakeWorkId(workId, uid);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
+    WorkKey workKey = WorkStatus::MakeWorkKey(workId, uid);
     if (uidQueueMap_.count(uid) > 0) {
         auto queue = uidQueueMap_.at(uid);
         if (!queue) {
             WS_HILOGE("IsLastWorkTimeout failed, queue is nullptr");
             return E_WORK_NOT_EXIST_FAILED;
         }
-        shared_ptr<WorkStatus> workStatus = queue->Find(workIdStr);
+        shared_ptr<WorkStatus> workStatus = queue->Find(workKey);
         if (workStatus != nullptr) {
             result = workStatus->IsLastWorkTimeout();
             return ERR_OK;
@@ -331,15 +396,7 @@ int32_t WorkPolicyManager::GetMaxRunningCount(WorkSchedSystemPolicy& systemPolic
 
 int32_t WorkPolicyManager::GetRunningCount()
 {
-    WS_HILOGD("enter");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
-    int32_t count = 0;
-    auto it = uidQueueMap_.begin();
-    while (it != uidQueueMap_.end()) {
-        count += it->second->GetRunningCount();
-        it++;
-    }
-    return count;
+    return WorkStatus::GetRunningCount();
 }
 
 void WorkPolicyManager::OnPolicyChanged(PolicyType policyType, shared_ptr<DetectorValue> detectorVal)
@@ -354,8 +411,14 @@ void WorkPolicyManager::OnPolicyChanged(PolicyType policyType, shared_ptr<Detect
         WS_HILOGE("service is null");
         return;
     }
+    if (policyType == PolicyType::APP_ADDED || policyType == PolicyType::APP_CHANGED ||
+        policyType == PolicyType::APP_REMOVED) {
+        DelayedSingleton<DataManager>::GetInstance()->ClearMailApp(detectorVal->strVal);
+        DelayedSingleton<WorkSchedulerConfig>::GetInstance()->ClearSignatureCache(detectorVal->strVal);
+    }
     switch (policyType) {
         case PolicyType::USER_SWITCHED: {
+            DelayedSingleton<DataManager>::GetInstance()->RefreshActiveUsers();
             service->InitPreinstalledWork();
             break;
         }
@@ -367,9 +430,14 @@ void WorkPolicyManager::OnPolicyChanged(PolicyType policyType, shared_ptr<Detect
             break;
         }
         case PolicyType::USER_STARTED: {
+            DelayedSingleton<DataManager>::GetInstance()->RefreshActiveUsers();
             service->InitPreinstalledWork();
             break;
         }
+        case PolicyType::USER_STOPPED: {
+            DelayedSingleton<DataManager>::GetInstance()->RefreshActiveUsers();
+            break;
+        }
         case PolicyType::APP_REMOVED: {
             int32_t uid = detectorVal->intVal;
             WorkStatus::ClearUidLastTimeMap(uid);
@@ -377,6 +445,8 @@ void WorkPolicyManager::OnPolicyChanged(PolicyType policyType, shared_ptr<Detect
             int32_t userId = WorkSchedUtils::GetUserIdByUid(uid);
             DelayedSingleton<DataManager>::GetInstance()->ClearGroup(detectorVal->strVal, userId);
             service->ResetExecFrequencyWhenAppRemove(uid);
+            execHistory_->RemoveByUid(uid);
+            PostRefreshExecHistory();
             break;
         }
         default: {}
@@ -420,19 +490,29 @@ void WorkPolicyManager::CheckWorkToRun()
         return;
     }
     handler_->RemoveEvent(WorkEventHandler::RETRIGGER_MSG);
-    shared_ptr<WorkStatus> topWork = GetWorkToRun();
+    WorkSchedSystemPolicy systemPolicy;
+    int32_t runningCount = GetRunningCount();
+    int32_t allowRunningCount = GetMaxRunningCount(systemPolicy);
+    std::function<bool(const shared_ptr<WorkStatus>&)> admit;
+    if (weightedPolicy_->IsEnabled() && runningCount > 0) {
+        // a heavy work over the budget does not hold back the cheaper ready works behind it.
+        auto weightedPolicy = weightedPolicy_;
+        admit = [weightedPolicy, allowRunningCount, runningCount](const shared_ptr<WorkStatus> &work) {
+            return weightedPolicy->CanRun(work, allowRunningCount, runningCount);
+        };
+    }
+    shared_ptr<WorkStatus> topWork = GetWorkToRun(allowRunningCount - runningCount <= SCARCE_SLOT_COUNT, admit);
     if (topWork == nullptr) {
         WS_HILOGD("no condition ready work not running, return.");
         return;
     }
-    WorkSchedSystemPolicy systemPolicy;
-    int32_t runningCount = GetRunningCount();
-    int32_t allowRunningCount = GetMaxRunningCount(systemPolicy);
     if (HasSystemPolicyEventSend() && allowRunningCount == MAX_RUNNING_COUNT && runningCount < MAX_RUNNING_COUNT) {
         SetSystemPolicyEventSend(false);
         WorkSchedUtil::HiSysEventSystemPolicyLimit(systemPolicy);
     }
-    if (runningCount < allowRunningCount || IsSpecialScene(topWork, runningCount)) {
+    if (weightedPolicy_->CanRun(topWork, allowRunningCount, runningCount) ||
+        IsSpecialScene(topWork, runningCount)) {
+        topWork->SetRunningCost(weightedPolicy_->GetWorkCost(topWork));
         if (topWork->workInfo_->IsSA()) {
             RealStartSA(topWork);
         } else {
@@ -462,10 +542,17 @@ void WorkPolicyManager::RemoveAllUnReady()
     conditionReadyQueue_->RemoveUnReady();
 }
 
-std::shared_ptr<WorkStatus> WorkPolicyManager::GetWorkToRun()
+std::shared_ptr<WorkStatus> WorkPolicyManager::GetWorkToRun(bool isSlotScarce,
+    const std::function<bool(const std::shared_ptr<WorkStatus>&)> &admit)
 {
-    shared_ptr<WorkStatus> topWork = conditionReadyQueue_->GetWorkToRunByPriority();
-    return topWork;
+    if (!isSlotScarce) {
+        return conditionReadyQueue_->GetWorkToRunByPriority(nullptr, admit);
+    }
+    // short and reliable works go first when only the last slots are left.
+    auto execHistory = execHistory_;
+    return conditionReadyQueue_->GetWorkToRunByPriority([execHistory](const shared_ptr<WorkStatus> &work) {
+        return execHistory->GetRank(work);
+    }, admit);
 }
 
 void WorkPolicyManager::RealStartSA(std::shared_ptr<WorkStatus> topWork)
@@ -549,9 +636,9 @@ void WorkPolicyManager::UpdateWatchdogTime(const std::shared_ptr<WorkSchedulerSe
         return;
     }
     int32_t chargerStatus = 0;
-    auto iter = topWork->conditionMap_.find(WorkCondition::Type::CHARGER);
-    if (iter != topWork->conditionMap_.end() && iter->second) {
-        chargerStatus = topWork->conditionMap_.at(WorkCondition::Type::CHARGER)->enumVal;
+    auto charger = topWork->GetCurrentCondition(WorkCondition::Type::CHARGER);
+    if (charger != nullptr) {
+        chargerStatus = charger->enumVal;
     } else {
         WS_HILOGD("charger is in CHARGING_UNKNOWN status");
         chargerStatus = static_cast<int32_t>(WorkCondition::Charger::CHARGING_UNKNOWN);
@@ -574,6 +661,7 @@ void WorkPolicyManager::AddWatchdogForWork(std::shared_ptr<WorkStatus> workStatu
     watchdog_->AddWatchdog(watchId, watchdogTime_.load());
     workStatus->workStartTime_ = WorkSchedUtils::GetCurrentTimeMs();
     workStatus->workWatchDogTime_ = static_cast<uint64_t>(watchdogTime_.load());
+    workStatus->ArmTimeoutDeadline();
     std::lock_guard<ffrt::mutex> lock(watchdogIdMapMutex_);
     watchdogIdMap_.emplace(watchId, workStatus);
 }
@@ -620,7 +708,7 @@ std::shared_ptr<WorkStatus> WorkPolicyManager::GetWorkFromWatchdog(uint32_t id)
 vector<WorkInfo> WorkPolicyManager::ObtainAllWorks(int32_t &uid)
 {
     WS_HILOGD("Wenter");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     vector<WorkInfo> allWorks;
     if (uidQueueMap_.count(uid) > 0) {
         auto queue = uidQueueMap_.at(uid);
@@ -628,9 +716,10 @@ vector<WorkInfo> WorkPolicyManager::ObtainAllWorks(int32_t &uid)
             WS_HILOGE("ObtainAllWorks failed, queue is nullptr");
             return allWorks;
         }
-        auto allWorkStatus = queue->GetWorkList();
-        std::transform(allWorkStatus.begin(), allWorkStatus.end(), std::back_inserter(allWorks),
-            [](std::shared_ptr<WorkStatus> it) { return *(it->workInfo_); });
+        allWorks.reserve(queue->GetSize());
+        queue->ForEach([&allWorks](const std::shared_ptr<WorkStatus> &it) {
+            allWorks.emplace_back(*(it->workInfo_));
+        });
     }
     return allWorks;
 }
@@ -638,14 +727,14 @@ vector<WorkInfo> WorkPolicyManager::ObtainAllWorks(int32_t &uid)
 shared_ptr<WorkInfo> WorkPolicyManager::GetWorkStatus(int32_t &uid, int32_t &workId)
 {
     WS_HILOGD("enter");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     if (uidQueueMap_.count(uid) > 0) {
         auto queue = uidQueueMap_.at(uid);
         if (!queue) {
             WS_HILOGE("GetWorkStatus failed, queue is nullptr");
             return nullptr;
         }
-        auto workStatus = queue->Find(string("u") + to_string(uid) + "_" + to_string(workId));
+        auto workStatus = queue->Find(WorkStatus::MakeWorkKey(workId, uid));
         if (workStatus != nullptr) {
             return workStatus->workInfo_;
         }
@@ -656,7 +745,7 @@ shared_ptr<WorkInfo> WorkPolicyManager::GetWorkStatus(int32_t &uid, int32_t &wor
 list<std::shared_ptr<WorkStatus>> WorkPolicyManager::GetAllWorkStatus(int32_t &uid)
 {
     WS_HILOGD("enter");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     list<shared_ptr<WorkStatus>> allWorks;
     if (uidQueueMap_.count(uid) > 0) {
         allWorks = uidQueueMap_.at(uid)->GetWorkList();
@@ -667,7 +756,7 @@ list<std::shared_ptr<WorkStatus>> WorkPolicyManager::GetAllWorkStatus(int32_t &u
 std::vector<WorkInfo> WorkPolicyManager::GetAllRunningWorks()
 {
     WS_HILOGD("enter");
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     vector<WorkInfo> allWorks;
     auto it = uidQueueMap_.begin();
     while (it != uidQueueMap_.end()) {
@@ -685,7 +774,7 @@ void WorkPolicyManager::DumpConditionReadyQueue(string& result)
 
 void WorkPolicyManager::DumpUidQueueMap(string& result)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     for (auto it : uidQueueMap_) {
         result.append("uid: " + std::to_string(it.first) + ":\n");
         it.second->Dump(result);
@@ -707,6 +796,12 @@ void WorkPolicyManager::Dump(string& result)
     int32_t maxRunningCount = GetMaxRunningCount(systemPolicy);
     result.append(to_string(maxRunningCount) +
         (maxRunningCount == MAX_RUNNING_COUNT ? "" : " " + systemPolicy.GetInfo()) + "\n");
+
+    result.append("4. weightedPolicy:");
+    weightedPolicy_->Dump(result);
+
+    result.append("5. execHistory:");
+    execHistory_->Dump(result);
 }
 
 uint32_t WorkPolicyManager::NewWatchdogId()
@@ -725,6 +820,7 @@ int32_t WorkPolicyManager::GetDumpSetMemory()
 void WorkPolicyManager::SetMemoryByDump(int32_t memory)
 {
     dumpSetMemory_ = memory;
+    InvalidatePolicySamples();
 }
 
 int32_t WorkPolicyManager::GetDumpSetCpuUsage()
@@ -735,6 +831,7 @@ int32_t WorkPolicyManager::GetDumpSetCpuUsage()
 void WorkPolicyManager::SetCpuUsageByDump(int32_t cpu)
 {
     dumpSetCpu_ = cpu;
+    InvalidatePolicySamples();
 }
 
 int32_t WorkPolicyManager::GetDumpSetMaxRunningCount()
@@ -755,6 +852,7 @@ int32_t WorkPolicyManager::GetDumpSetThermalLevel()
 void WorkPolicyManager::SetThermalLevelByDump(int32_t thermalLevel)
 {
     dumpSetThermalLevel_ = thermalLevel;
+    InvalidatePolicySamples();
 }
 
 void WorkPolicyManager::SetWatchdogTimeByDump(int32_t time)
@@ -776,7 +874,7 @@ int32_t WorkPolicyManager::WorkPolicyManager::GetWatchdogTime()
 
 void WorkPolicyManager::DumpCheckIdeWorkToRun(const std::string &bundleName, const std::string &abilityName)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(ideDebugListMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(ideDebugListMutex_, LockLevel::POLICY_IDE_DEBUG);
     ideDebugList = GetAllIdeWorkStatus(bundleName, abilityName);
     if (ideDebugList.empty()) {
         WS_HILOGE("ideDebugList is empty, please add one work");
@@ -809,7 +907,7 @@ void WorkPolicyManager::DumpTriggerWork(int32_t uId, int32_t workId, std::string
 
 void WorkPolicyManager::TriggerIdeWork()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(ideDebugListMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(ideDebugListMutex_, LockLevel::POLICY_IDE_DEBUG);
     if (ideDebugList.empty()) {
         WS_HILOGI("ideDebugList has been empty, all the works have been done");
         return;
@@ -853,23 +951,19 @@ std::list<std::shared_ptr<WorkStatus>> WorkPolicyManager::GetAllIdeWorkStatus(co
     const std::string &abilityName)
 {
     int32_t currentAccountId = WorkSchedUtils::GetCurrentAccountId();
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     std::list<shared_ptr<WorkStatus>> allWorks;
     auto it = uidQueueMap_.begin();
     while (it != uidQueueMap_.end()) {
-        if (it->second->GetWorkList().empty()) {
-            it++;
-            continue;
-        }
         bool isExist = false;
-        for (auto work : it->second->GetWorkList()) {
+        it->second->ForEach([&](const shared_ptr<WorkStatus> &work) {
             if (work->workInfo_->GetBundleName() == bundleName &&
                 work->workInfo_->GetAbilityName() == abilityName &&
                 (work->userId_ == 0 || work->userId_ == currentAccountId)) {
                 allWorks.push_back(work);
                 isExist = true;
             }
-        }
+        });
         if (isExist) {
             return allWorks;
         }
@@ -941,6 +1035,7 @@ int32_t WorkPolicyManager::ResumePausedWorks(int32_t uid)
             workStatus->paused_ = false;
             watchdog_->AddWatchdog(it->first, watchdogTime);
             workStatus->workStartTime_ = WorkSchedUtils::GetCurrentTimeMs();
+            workStatus->ArmTimeoutDeadline();
         }
     }
 
@@ -961,7 +1056,7 @@ void WorkPolicyManager::RemoveWatchDog(std::shared_ptr<WorkStatus> workStatus)
     std::lock_guard<ffrt::mutex> lock(watchdogIdMapMutex_);
     uint32_t watchdogId = UINT32_MAX;
     for (auto it = watchdogIdMap_.begin(); it != watchdogIdMap_.end(); it++) {
-        if (workStatus->workId_ == it->second->workId_) {
+        if (workStatus->workKey_ == it->second->workKey_) {
             watchdog_->RemoveWatchdog(it->first);
             watchdogId = it->first;
             break;
@@ -975,7 +1070,7 @@ void WorkPolicyManager::RemoveWatchDog(std::shared_ptr<WorkStatus> workStatus)
 std::list<std::shared_ptr<WorkStatus>> WorkPolicyManager::GetDeepIdleWorks()
 {
     std::list<shared_ptr<WorkStatus>> deepIdleWorkds;
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     auto it = uidQueueMap_.begin();
     while (it != uidQueueMap_.end()) {
         std::list<std::shared_ptr<WorkStatus>> workList = it->second->GetDeepIdleWorks();
@@ -989,14 +1084,14 @@ std::list<std::shared_ptr<WorkStatus>> WorkPolicyManager::GetDeepIdleWorks()
 
 bool WorkPolicyManager::FindWork(int32_t uid)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     auto iter = uidQueueMap_.find(uid);
     return iter != uidQueueMap_.end() && iter->second->GetSize() > 0;
 }
 
 bool WorkPolicyManager::FindWork(const int32_t userId, const std::string &bundleName)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(uidMapMutex_);
+    OrderedLockGuard<ffrt::mutex> lock(uidMapMutex_, LockLevel::POLICY_UID_MAP);
     for (auto list : uidQueueMap_) {
         if (list.second && list.second->Find(userId, bundleName)) {
             return true;
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <set>
 #include "work_queue.h"
 
@@ -20,49 +21,114 @@
 #include "work_sched_errors.h"
 #include "work_scheduler_service.h"
 #include "work_sched_constants.h"
+#include "system_state_snapshot.h"
 
 using namespace std;
 
 namespace OHOS {
 namespace WorkScheduler {
+namespace {
+const size_t HEAP_ROOT = 0;
+const size_t HEAP_ARITY = 2;
+// at most this many ready works of the lowest priority are compared by rank.
+const size_t MAX_RANKED_COUNT = 8;
+}
+
 vector<shared_ptr<WorkStatus>> WorkQueue::OnConditionChanged(WorkCondition::Type type,
     shared_ptr<DetectorValue> conditionVal)
 {
-    shared_ptr<Condition> value = ParseCondition(type, conditionVal);
+    shared_ptr<Condition> value = GetEventCondition(type, conditionVal);
     vector<shared_ptr<WorkStatus>> result;
     std::set<int32_t> uidList;
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    workList_.sort(WorkComp());
-    for (auto it : workList_) {
-        if (type == WorkCondition::Type::DEEP_IDLE && value) {
-            int32_t saId = value->enumVal;
-            if (saId != DEFAULT_SA_ID && saId != it->workInfo_->GetSaId()) {
-                continue;
-            }
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    RefreshStaleKeys();
+    VisitByPriority([&](size_t index) {
+        CollectReadyWork(workHeap_[index].work, type, value, result, uidList);
+        return true;
+    });
+    return result;
+}
+
+vector<shared_ptr<WorkStatus>> WorkQueue::OnConditionChanged(WorkCondition::Type type,
+    shared_ptr<DetectorValue> conditionVal, const std::unordered_set<WorkKey, WorkKeyHash> &candidates)
+{
+    shared_ptr<Condition> value = GetEventCondition(type, conditionVal);
+    vector<shared_ptr<WorkStatus>> result;
+    std::set<int32_t> uidList;
+    // ready and running works are re-emitted as the full judge does, the other works read the new value from the
+    // system state snapshot when they are judged next time, repeating works are triggered by the TIMER queue.
+    vector<WorkKey> activeWorks;
+    WorkStatus::GetActiveWorks(activeWorks);
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    vector<WorkNode> visitNodes;
+    auto visit = [&](const WorkKey &workKey) {
+        auto iter = heapIndex_.find(workKey);
+        if (iter == heapIndex_.end()) {
+            return;
         }
-        if (it->OnConditionChanged(type, value) == E_GROUP_CHANGE_NOT_MATCH_HAP) {
-            continue;
+        visitNodes.push_back(workHeap_[iter->second]);
+        visitNodes.back().priority = visitNodes.back().work->priority_;
+    };
+    for (const auto &workKey : candidates) {
+        visit(workKey);
+    }
+    for (const auto &workKey : activeWorks) {
+        if (candidates.count(workKey) == 0) {
+            visit(workKey);
         }
-        if (uidList.count(it->uid_) > 0 && it->GetMinInterval() != 0 &&
-            !DelayedSingleton<WorkSchedulerService>::GetInstance()->CheckEffiResApplyInfo(it->uid_)) {
-            WS_HILOGI("One uid can start only one work, uid:%{public}d, bundleName:%{public}s",
-                it->uid_, it->bundleName_.c_str());
-            continue;
+    }
+    std::sort(visitNodes.begin(), visitNodes.end(), NodeLess);
+    for (const auto &node : visitNodes) {
+        CollectReadyWork(node.work, type, value, result, uidList);
+    }
+    return result;
+}
+
+void WorkQueue::CollectReadyWork(const shared_ptr<WorkStatus> &work, WorkCondition::Type type,
+    shared_ptr<Condition> value, vector<shared_ptr<WorkStatus>> &result, std::set<int32_t> &uidList)
+{
+    if (type == WorkCondition::Type::DEEP_IDLE && value) {
+        int32_t saId = value->enumVal;
+        if (saId != DEFAULT_SA_ID && saId != work->workInfo_->GetSaId()) {
+            return;
         }
-        bool isReady = it->workInfo_->IsSA() ? it->IsSAReady() : it->IsReady();
-        if (isReady) {
-            result.emplace_back(it);
-            uidList.insert(it->uid_);
-        } else {
-            if (it->IsReadyStatus()) {
-                it->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
-            }
+    }
+    if (work->OnConditionChanged(type, value) == E_GROUP_CHANGE_NOT_MATCH_HAP) {
+        return;
+    }
+    if (uidList.count(work->uid_) > 0 && work->GetMinInterval() != 0 &&
+        !DelayedSingleton<WorkSchedulerService>::GetInstance()->CheckEffiResApplyInfo(work->uid_)) {
+        WS_HILOGI("One uid can start only one work, uid:%{public}d, bundleName:%{public}s",
+            work->uid_, work->bundleName_.c_str());
+        return;
+    }
+    bool isReady = work->workInfo_->IsSA() ? work->IsSAReady() : work->IsReady();
+    if (isReady) {
+        result.emplace_back(work);
+        uidList.insert(work->uid_);
+    } else {
+        if (work->IsReadyStatus()) {
+            work->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
         }
-        if (it->needRetrigger_) {
-            result.emplace_back(it);
+    }
+    if (work->needRetrigger_) {
+        result.emplace_back(work);
+    }
+}
+
+shared_ptr<Condition> WorkQueue::GetEventCondition(WorkCondition::Type type,
+    const shared_ptr<DetectorValue> &conditionVal)
+{
+    // WorkQueueManager publishes a system state before it judges the queues, deep idle of one SA is not published.
+    bool isPublished = SystemStateSnapshot::IsSystemState(type) && conditionVal &&
+        !(type == WorkCondition::Type::DEEP_IDLE && conditionVal->intVal != DEFAULT_SA_ID);
+    if (isPublished) {
+        auto snapshot = SystemStateSnapshot::GetCurrent();
+        if (snapshot && snapshot->GetCondition(type)) {
+            return snapshot->GetCondition(type);
         }
     }
-    return result;
+    return ParseCondition(type, conditionVal);
 }
 
 shared_ptr<Condition> WorkQueue::ParseCondition(WorkCondition::Type type,
@@ -109,73 +175,76 @@ shared_ptr<Condition> WorkQueue::ParseCondition(WorkCondition::Type type,
 
 void WorkQueue::Push(shared_ptr<vector<shared_ptr<WorkStatus>>> workStatusVector)
 {
-    for (auto it : *workStatusVector) {
-        Push(it);
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    for (const auto &it : *workStatusVector) {
+        PushLocked(it);
     }
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    workList_.sort(WorkComp());
 }
 
 void WorkQueue::Push(shared_ptr<WorkStatus> workStatus)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    if (this->Contains(make_shared<string>(workStatus->workId_))) {
-        for (auto it : workList_) {
-            if (it->workId_.compare(workStatus->workId_) == 0) {
-                return;
-            }
-        }
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    PushLocked(workStatus);
+}
+
+void WorkQueue::PushLocked(const shared_ptr<WorkStatus> &workStatus)
+{
+    auto result = heapIndex_.emplace(workStatus->workKey_, workHeap_.size());
+    if (!result.second) {
         return;
     }
-    workList_.push_back(workStatus);
+    InvalidateView();
+    workHeap_.push_back({workStatus, workStatus->priority_, nextSequence_++, &result.first->second});
+    SiftUp(workHeap_.size() - 1);
 }
 
 bool WorkQueue::Remove(shared_ptr<WorkStatus> workStatus)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    auto iter = std::find(workList_.cbegin(), workList_.cend(), workStatus);
-    if (iter != workList_.end()) {
-        workList_.remove(*iter);
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    auto iter = heapIndex_.find(workStatus->workKey_);
+    if (iter != heapIndex_.end() && workHeap_[iter->second].work == workStatus) {
+        EraseNode(iter->second);
     }
     return true;
 }
 
 uint32_t WorkQueue::GetSize()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    return workList_.size();
+    return LoadView()->works.size();
 }
 
 bool WorkQueue::Contains(std::shared_ptr<std::string> workId)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    auto iter = std::find_if(workList_.cbegin(), workList_.cend(), [&workId]
-        (const shared_ptr<WorkStatus> &workStatus) { return workId->compare(workStatus->workId_) == 0; });
-    if (iter != workList_.end()) {
-        return true;
+    WorkKey workKey;
+    if (workId == nullptr || !WorkKey::FromString(*workId, workKey)) {
+        return false;
     }
-    return false;
+    return Contains(workKey);
 }
 
-shared_ptr<WorkStatus> WorkQueue::Find(string workId)
+bool WorkQueue::Contains(const WorkKey &workKey)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    auto iter = std::find_if(workList_.cbegin(), workList_.cend(),
-        [&workId](const shared_ptr<WorkStatus> &workStatus) { return workStatus->workId_ == workId; });
-    if (iter != workList_.end()) {
-        return *iter;
+    return LoadView()->index.count(workKey) > 0;
+}
+
+shared_ptr<WorkStatus> WorkQueue::Find(const WorkKey &workKey)
+{
+    auto view = LoadView();
+    auto iter = view->index.find(workKey);
+    if (iter != view->index.end()) {
+        return iter->second;
     }
     return nullptr;
 }
 
 shared_ptr<WorkStatus> WorkQueue::FindSA(int32_t saId)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    auto iter = std::find_if(workList_.cbegin(), workList_.cend(),
-        [&saId](const shared_ptr<WorkStatus> &workStatus) {
-            return workStatus->workInfo_->IsSA() && workStatus->workInfo_->GetSaId() == saId;
+    auto view = LoadView();
+    auto iter = std::find_if(view->works.cbegin(), view->works.cend(),
+        [&saId](const shared_ptr<WorkStatus> &work) {
+            return work->workInfo_->IsSA() && work->workInfo_->GetSaId() == saId;
         });
-    if (iter != workList_.end()) {
+    if (iter != view->works.cend()) {
         return *iter;
     }
     return nullptr;
@@ -183,57 +252,173 @@ shared_ptr<WorkStatus> WorkQueue::FindSA(int32_t saId)
 
 bool WorkQueue::Find(const int32_t userId, const std::string &bundleName)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    auto iter = std::find_if(workList_.cbegin(), workList_.cend(),
-        [userId, &bundleName](const shared_ptr<WorkStatus> &workStatus) {
-            return workStatus->userId_ == userId && workStatus->bundleName_ == bundleName;
+    auto view = LoadView();
+    auto iter = std::find_if(view->works.cbegin(), view->works.cend(),
+        [userId, &bundleName](const shared_ptr<WorkStatus> &work) {
+            return work->userId_ == userId && work->bundleName_ == bundleName;
         });
-    return iter != workList_.end();
+    return iter != view->works.cend();
 }
 
 shared_ptr<WorkStatus> WorkQueue::GetWorkToRunByPriority()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    workList_.sort(WorkComp());
-    auto work = workList_.begin();
-    shared_ptr<WorkStatus> workStatus = nullptr;
-    while (work != workList_.end()) {
-        if ((*work)->GetStatus() == WorkStatus::CONDITION_READY) {
-            workStatus = *work;
-            workStatus->priority_++;
-            break;
-        }
-        work++;
+    return GetWorkToRunByPriority(nullptr);
+}
+
+shared_ptr<WorkStatus> WorkQueue::GetWorkToRunByPriority(
+    const std::function<uint64_t(const shared_ptr<WorkStatus>&)> &rank,
+    const std::function<bool(const shared_ptr<WorkStatus>&)> &admit)
+{
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    size_t readyIndex = FindWorkToRunLocked(rank, admit);
+    if (readyIndex == workHeap_.size()) {
+        return nullptr;
     }
+    WorkNode &node = workHeap_[readyIndex];
+    shared_ptr<WorkStatus> workStatus = node.work;
+    // Other queues holding this work see the new priority when they reach its node, see FindWorkToRunLocked.
+    workStatus->priority_++;
+    node.priority = workStatus->priority_;
+    node.sequence = nextSequence_++;
+    SiftDown(readyIndex);
     return workStatus;
 }
 
+size_t WorkQueue::FindWorkToRunLocked(const std::function<uint64_t(const shared_ptr<WorkStatus>&)> &rank,
+    const std::function<bool(const shared_ptr<WorkStatus>&)> &admit)
+{
+    // priorities only grow, so a node whose work was picked by another queue sits too early in this heap and
+    // every node behind the stopping point is in order. Only the stale nodes reached are re-keyed.
+    while (true) {
+        size_t readyIndex = workHeap_.size();
+        // returned when admit rejects every ready work, so the caller still sees what is waiting.
+        size_t firstReadyIndex = workHeap_.size();
+        uint64_t readyRank = 0;
+        size_t rankedCount = 0;
+        std::vector<WorkKey> staleKeys;
+        VisitByPriority([&](size_t index) {
+            const WorkNode &node = workHeap_[index];
+            if (readyIndex != workHeap_.size() && node.priority != workHeap_[readyIndex].priority) {
+                return false;
+            }
+            if (node.priority != node.work->priority_) {
+                staleKeys.push_back(node.work->workKey_);
+                return true;
+            }
+            if (node.work->GetStatus() != WorkStatus::CONDITION_READY) {
+                return true;
+            }
+            if (firstReadyIndex == workHeap_.size()) {
+                firstReadyIndex = index;
+            }
+            if (admit && !admit(node.work)) {
+                return true;
+            }
+            if (!rank) {
+                readyIndex = index;
+                return false;
+            }
+            uint64_t nodeRank = rank(node.work);
+            if (readyIndex == workHeap_.size() || nodeRank < readyRank) {
+                readyIndex = index;
+                readyRank = nodeRank;
+            }
+            return ++rankedCount < MAX_RANKED_COUNT;
+        });
+        if (staleKeys.empty()) {
+            return readyIndex != workHeap_.size() ? readyIndex : firstReadyIndex;
+        }
+        for (const auto &workKey : staleKeys) {
+            size_t index = heapIndex_[workKey];
+            workHeap_[index].priority = workHeap_[index].work->priority_;
+            workHeap_[index].sequence = nextSequence_++;
+            SiftDown(index);
+            SiftUp(index);
+        }
+    }
+}
+
 bool WorkQueue::CancelWork(shared_ptr<WorkStatus> workStatus)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    workList_.remove(workStatus);
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    auto iter = heapIndex_.find(workStatus->workKey_);
+    if (iter != heapIndex_.end() && workHeap_[iter->second].work == workStatus) {
+        EraseNode(iter->second);
+    }
     return true;
 }
 
 list<shared_ptr<WorkStatus>> WorkQueue::GetWorkList()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    return workList_;
+    auto view = LoadView();
+    return list<shared_ptr<WorkStatus>>(view->works.begin(), view->works.end());
+}
+
+WorkQueue::WorkSnapshot WorkQueue::GetSnapshot()
+{
+    auto view = LoadView();
+    return WorkSnapshot(view, &view->works);
+}
+
+void WorkQueue::ForEach(const std::function<void(const shared_ptr<WorkStatus>&)> &visitor)
+{
+    auto view = LoadView();
+    for (const auto &work : view->works) {
+        visitor(work);
+    }
+}
+
+shared_ptr<const WorkQueue::WorkView> WorkQueue::LoadView()
+{
+    auto view = std::atomic_load(&view_);
+    if (view) {
+        return view;
+    }
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    view = std::atomic_load(&view_);
+    if (view) {
+        return view;
+    }
+    auto newView = std::make_shared<WorkView>();
+    newView->works.reserve(workHeap_.size());
+    newView->index.reserve(workHeap_.size());
+    for (const auto &node : workHeap_) {
+        newView->works.emplace_back(node.work);
+        newView->index.emplace(node.work->workKey_, node.work);
+    }
+    view = newView;
+    std::atomic_store(&view_, view);
+    return view;
+}
+
+void WorkQueue::InvalidateView()
+{
+    std::atomic_store(&view_, shared_ptr<const WorkView>());
 }
 
 void WorkQueue::RemoveUnReady()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    workList_.remove_if([](shared_ptr<WorkStatus> value) {
-        return (value->GetStatus() != WorkStatus::Status::CONDITION_READY);
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    auto iter = std::remove_if(workHeap_.begin(), workHeap_.end(), [this](const WorkNode &node) {
+        if (node.work->GetStatus() != WorkStatus::Status::CONDITION_READY) {
+            heapIndex_.erase(node.work->workKey_);
+            return true;
+        }
+        return false;
     });
+    if (iter == workHeap_.end()) {
+        return;
+    }
+    InvalidateView();
+    workHeap_.erase(iter, workHeap_.end());
+    Heapify();
 }
 
 int32_t WorkQueue::GetRunningCount()
 {
     int32_t count = 0;
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    for (shared_ptr<WorkStatus> work : workList_) {
+    auto view = LoadView();
+    for (const auto &work : view->works) {
         if (work->IsRunning()) {
             count++;
         }
@@ -244,8 +429,8 @@ int32_t WorkQueue::GetRunningCount()
 std::vector<WorkInfo> WorkQueue::GetRunningWorks()
 {
     std::vector<WorkInfo> workInfo;
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    for (shared_ptr<WorkStatus> work : workList_) {
+    auto view = LoadView();
+    for (const auto &work : view->works) {
         if (work->IsRunning()) {
             auto info = WorkInfo();
             info.SetElement(work->bundleName_, work->abilityName_);
@@ -259,8 +444,8 @@ std::vector<WorkInfo> WorkQueue::GetRunningWorks()
 std::list<std::shared_ptr<WorkStatus>> WorkQueue::GetDeepIdleWorks()
 {
     std::list<std::shared_ptr<WorkStatus>> works;
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    for (shared_ptr<WorkStatus> work : workList_) {
+    auto view = LoadView();
+    for (const auto &work : view->works) {
         if (work->IsRunning() && work->workInfo_->GetDeepIdle() == WorkCondition::DeepIdle::DEEP_IDLE_IN &&
             !work->workInfo_->IsSA()) {
             works.emplace_back(work);
@@ -271,36 +456,151 @@ std::list<std::shared_ptr<WorkStatus>> WorkQueue::GetDeepIdleWorks()
 
 void WorkQueue::GetWorkIdStr(string& result)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    for (auto it : workList_) {
-        result.append(it->workId_ + ", ");
+    auto view = LoadView();
+    for (const auto &work : view->works) {
+        result.append(work->workId_ + ", ");
     }
 }
 
 void WorkQueue::Dump(string& result)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    for (auto it : workList_) {
-        it->Dump(result);
-    }
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    RefreshStaleKeys();
+    VisitByPriority([this, &result](size_t index) {
+        workHeap_[index].work->Dump(result);
+        return true;
+    });
 }
 
 void WorkQueue::ClearAll()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    workList_.clear();
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    workHeap_.clear();
+    heapIndex_.clear();
+    InvalidateView();
 }
 
-bool WorkComp::operator () (const shared_ptr<WorkStatus> w1, const shared_ptr<WorkStatus> w2)
+void WorkQueue::SetMinIntervalByDump(int64_t interval)
 {
-    return w1->priority_ < w2->priority_;
+    OrderedLockGuard<ffrt::mutex> lock(workListMutex_, LockLevel::WORK_QUEUE);
+    for (const auto &node : workHeap_) {
+        node.work->SetMinIntervalByDump(interval);
+    }
 }
 
-void WorkQueue::SetMinIntervalByDump(int64_t interval)
+bool WorkQueue::NodeLess(const WorkNode &lhs, const WorkNode &rhs)
+{
+    if (lhs.priority != rhs.priority) {
+        return lhs.priority < rhs.priority;
+    }
+    return lhs.sequence < rhs.sequence;
+}
+
+void WorkQueue::SwapNode(size_t lhs, size_t rhs)
+{
+    std::swap(workHeap_[lhs], workHeap_[rhs]);
+    *workHeap_[lhs].position = lhs;
+    *workHeap_[rhs].position = rhs;
+}
+
+void WorkQueue::SiftUp(size_t index)
+{
+    while (index > HEAP_ROOT) {
+        size_t parent = (index - 1) / HEAP_ARITY;
+        if (!NodeLess(workHeap_[index], workHeap_[parent])) {
+            break;
+        }
+        SwapNode(index, parent);
+        index = parent;
+    }
+}
+
+void WorkQueue::SiftDown(size_t index)
+{
+    size_t size = workHeap_.size();
+    while (true) {
+        size_t smallest = index;
+        size_t left = index * HEAP_ARITY + 1;
+        size_t right = left + 1;
+        if (left < size && NodeLess(workHeap_[left], workHeap_[smallest])) {
+            smallest = left;
+        }
+        if (right < size && NodeLess(workHeap_[right], workHeap_[smallest])) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+        SwapNode(index, smallest);
+        index = smallest;
+    }
+}
+
+void WorkQueue::EraseNode(size_t index)
+{
+    size_t last = workHeap_.size() - 1;
+    if (index != last) {
+        SwapNode(index, last);
+    }
+    heapIndex_.erase(workHeap_[last].work->workKey_);
+    workHeap_.pop_back();
+    InvalidateView();
+    if (index < workHeap_.size()) {
+        SiftDown(index);
+        SiftUp(index);
+    }
+}
+
+void WorkQueue::Heapify()
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(workListMutex_);
-    for (auto it : workList_) {
-        it->SetMinIntervalByDump(interval);
+    for (size_t i = 0; i < workHeap_.size(); i++) {
+        *workHeap_[i].position = i;
+    }
+    for (size_t i = workHeap_.size() / HEAP_ARITY; i > HEAP_ROOT; i--) {
+        SiftDown(i - 1);
+    }
+}
+
+void WorkQueue::RefreshStaleKeys()
+{
+    bool changed = false;
+    for (auto &node : workHeap_) {
+        if (node.priority != node.work->priority_) {
+            node.priority = node.work->priority_;
+            node.sequence = nextSequence_++;
+            changed = true;
+        }
+    }
+    if (changed) {
+        Heapify();
+    }
+}
+
+void WorkQueue::VisitByPriority(const std::function<bool(size_t)> &visitor)
+{
+    if (workHeap_.empty() || !visitor(HEAP_ROOT)) {
+        return;
+    }
+    // Best-first walk over the heap tree, the heap itself is left untouched.
+    auto greater = [this](size_t lhs, size_t rhs) { return NodeLess(workHeap_[rhs], workHeap_[lhs]); };
+    std::vector<size_t> frontier;
+    auto pushChildren = [this, &frontier, &greater](size_t index) {
+        for (size_t child = index * HEAP_ARITY + 1; child <= index * HEAP_ARITY + HEAP_ARITY; child++) {
+            if (child < workHeap_.size()) {
+                frontier.push_back(child);
+                std::push_heap(frontier.begin(), frontier.end(), greater);
+            }
+        }
+    };
+    pushChildren(HEAP_ROOT);
+    while (!frontier.empty()) {
+        std::pop_heap(frontier.begin(), frontier.end(), greater);
+        size_t index = frontier.back();
+        frontier.pop_back();
+        if (!visitor(index)) {
+            return;
+        }
+        pushChildren(index);
     }
 }
 } // namespace WorkScheduler
@@ -12,10 +12,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+
 #include <hisysevent.h>
 #include <ipc_skeleton.h>
 
 #include "work_queue_manager.h"
+#include "parameters.h"
 #include "work_scheduler_service.h"
 #include "work_sched_hilog.h"
 #include "work_sched_utils.h"
@@ -26,10 +31,44 @@ using namespace std;
 namespace OHOS {
 namespace WorkScheduler {
 static int32_t g_timeRetrigger = INT32_MAX;
+namespace {
+const int32_t CHARGER_BUCKET_NOT_CHARGING = -1;
+const int32_t DEFAULT_COALESCE_WINDOW_MS = 1000;
+const std::string COALESCE_WINDOW_PARAM = "persist.sys.workscheduler.coalesce_window_ms";
+const std::string PRINT_WORK_STATUS_PARAM = "persist.sys.workscheduler.print_work_status";
+const uint64_t PRINT_WORK_STATUS_INTERVAL_MS = 60 * 1000;
+
+int32_t GetChargerBucket(bool charging, int32_t chargerType)
+{
+    return charging ? chargerType : CHARGER_BUCKET_NOT_CHARGING;
+}
+
+std::set<int32_t> GetReadyNetworkBuckets(int32_t networkType)
+{
+    if (networkType == WorkCondition::Network::NETWORK_UNKNOWN) {
+        return {};
+    }
+    return {networkType, WorkCondition::Network::NETWORK_TYPE_ANY};
+}
 
-WorkQueueManager::WorkQueueManager(const std::shared_ptr<WorkSchedulerService>& wss) : wss_(wss)
+std::set<int32_t> GetReadyChargerBuckets(bool charging, int32_t chargerType)
+{
+    if (charging) {
+        return {chargerType, WorkCondition::Charger::CHARGING_PLUGGED_ANY};
+    }
+    if (chargerType == WorkCondition::Charger::CHARGING_UNPLUGGED) {
+        return {CHARGER_BUCKET_NOT_CHARGING};
+    }
+    return {};
+}
+}
+
+WorkQueueManager::WorkQueueManager(const std::shared_ptr<WorkSchedulerService>& wss)
+    : wss_(wss), workRegistry_(make_shared<WorkQueue>())
 {
     timeCycle_ = TIME_CYCLE;
+    coalesceWindowMs_ = OHOS::system::GetIntParameter(COALESCE_WINDOW_PARAM, DEFAULT_COALESCE_WINDOW_MS);
+    printWorkStatus_ = OHOS::system::GetBoolParameter(PRINT_WORK_STATUS_PARAM, false);
 }
 
 bool WorkQueueManager::Init()
@@ -39,7 +78,7 @@ bool WorkQueueManager::Init()
 
 bool WorkQueueManager::AddListener(WorkCondition::Type type, shared_ptr<IConditionListener> listener)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
     if (listenerMap_.count(type) > 0) {
         return false;
     }
@@ -53,7 +92,7 @@ bool WorkQueueManager::AddWork(shared_ptr<WorkStatus> workStatus)
         return false;
     }
     WS_HILOGD("workStatus ID: %{public}s", workStatus->workId_.c_str());
-    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
     auto map = workStatus->workInfo_->GetConditionMap();
     for (auto it : *map) {
         if (queueMap_.count(it.first) == 0) {
@@ -62,7 +101,13 @@ bool WorkQueueManager::AddWork(shared_ptr<WorkStatus> workStatus)
                 listenerMap_.at(it.first)->Start();
             }
         }
-        queueMap_.at(it.first)->Push(workStatus);
+        if (!queueMap_.at(it.first)->Contains(workStatus->workKey_)) {
+            queueMap_.at(it.first)->Push(workStatus);
+            AddToConditionIndex(it.first, workStatus);
+        }
+    }
+    if (!map->empty()) {
+        workRegistry_->Push(workStatus);
     }
     if (WorkSchedUtils::IsSystemApp()) {
         WS_HILOGD("Is system app, default group is active.");
@@ -73,30 +118,38 @@ bool WorkQueueManager::AddWork(shared_ptr<WorkStatus> workStatus)
 
 bool WorkQueueManager::RemoveWork(shared_ptr<WorkStatus> workStatus)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
     WS_HILOGD("workStatus ID: %{public}s", workStatus->workId_.c_str());
     auto map = workStatus->workInfo_->GetConditionMap();
     for (auto it : *map) {
         if (queueMap_.count(it.first) > 0) {
             queueMap_.at(it.first)->Remove(workStatus);
+            if (!queueMap_.at(it.first)->Contains(workStatus->workKey_)) {
+                RemoveFromConditionIndex(it.first, workStatus);
+            }
         }
         if (queueMap_.count(it.first) == 0) {
             listenerMap_.at(it.first)->Stop();
         }
     }
+    workRegistry_->Remove(workStatus);
     return true;
 }
 
 bool WorkQueueManager::CancelWork(shared_ptr<WorkStatus> workStatus)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
     WS_HILOGD("workStatus ID: %{public}s", workStatus->workId_.c_str());
     for (auto it : queueMap_) {
         it.second->CancelWork(workStatus);
+        if (!it.second->Contains(workStatus->workKey_)) {
+            RemoveFromConditionIndex(it.first, workStatus);
+        }
         if (queueMap_.count(it.first) == 0) {
             listenerMap_.at(it.first)->Stop();
         }
     }
+    workRegistry_->CancelWork(workStatus);
     // Notify work remove event to battery statistics
     int32_t pid = IPCSkeleton::GetCallingPid();
     HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::WORK_SCHEDULER,
@@ -109,16 +162,18 @@ vector<shared_ptr<WorkStatus>> WorkQueueManager::GetReayQueue(WorkCondition::Typ
     shared_ptr<DetectorValue> conditionVal)
 {
     vector<shared_ptr<WorkStatus>> result;
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    if (conditionType != WorkCondition::Type::GROUP && queueMap_.count(conditionType) > 0) {
-        shared_ptr<WorkQueue> workQueue = queueMap_.at(conditionType);
-        result = workQueue->OnConditionChanged(conditionType, conditionVal);
-    }
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
+    PublishSystemState(conditionType, conditionVal);
     if (conditionType == WorkCondition::Type::GROUP || conditionType == WorkCondition::Type::STANDBY) {
-        for (auto it : queueMap_) {
-            shared_ptr<WorkQueue> workQueue = it.second;
-            auto works = workQueue->OnConditionChanged(conditionType, conditionVal);
-            PushWork(works, result);
+        // broadcast conditions judge every work once, whichever queues it is in.
+        result = workRegistry_->OnConditionChanged(conditionType, conditionVal);
+    } else if (queueMap_.count(conditionType) > 0) {
+        shared_ptr<WorkQueue> workQueue = queueMap_.at(conditionType);
+        std::unordered_set<WorkKey, WorkKeyHash> candidates;
+        if (GetConditionCandidates(conditionType, conditionVal, candidates)) {
+            result = workQueue->OnConditionChanged(conditionType, conditionVal, candidates);
+        } else {
+            result = workQueue->OnConditionChanged(conditionType, conditionVal);
         }
     }
     bool hasStop = false;
@@ -148,40 +203,203 @@ vector<shared_ptr<WorkStatus>> WorkQueueManager::GetReayQueue(WorkCondition::Typ
     return result;
 }
 
-void WorkQueueManager::ClearTimeOutWorkStatus()
+vector<shared_ptr<WorkStatus>> WorkQueueManager::GetReadyWorksByUriKey(const std::string &uriKey)
 {
-    std::set<std::string> allWorkIds;
-    for (auto it : queueMap_) {
-        shared_ptr<WorkQueue> workQueue = it.second;
-        auto workList = workQueue->GetWorkList();
-        for (auto work : workList) {
-            if (work->IsRepeating() && !work->IsTimeout()) {
-                continue;
+    vector<shared_ptr<WorkStatus>> result;
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
+    auto works = workRegistry_->GetSnapshot();
+    for (const auto &work : *works) {
+        if (!work->workInfo_->IsPreinstalled() || work->workInfo_->GetUriKey() != uriKey) {
+            continue;
+        }
+        bool isReady = work->workInfo_->IsSA() ? work->IsSAReady() : work->IsReady();
+        if (isReady) {
+            result.push_back(work);
+        } else if (work->IsReadyStatus()) {
+            work->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
+        }
+    }
+    return result;
+}
+
+void WorkQueueManager::PublishSystemState(WorkCondition::Type type, const shared_ptr<DetectorValue> &conditionVal)
+{
+    if (!conditionVal || !SystemStateSnapshot::IsSystemState(type)) {
+        return;
+    }
+    if (type == WorkCondition::Type::DEEP_IDLE && conditionVal->intVal != DEFAULT_SA_ID) {
+        return;
+    }
+    auto snapshot = make_shared<const SystemStateSnapshot>(SystemStateSnapshot::GetCurrent(), type,
+        WorkQueue::ParseCondition(type, conditionVal));
+    SystemStateSnapshot::Publish(snapshot);
+}
+
+void WorkQueueManager::AddToConditionIndex(WorkCondition::Type type, const shared_ptr<WorkStatus> &workStatus)
+{
+    const auto &condition = workStatus->workInfo_->GetCondition(type);
+    if (!condition) {
+        return;
+    }
+    switch (type) {
+        case WorkCondition::Type::BATTERY_LEVEL:
+            batteryLevelIndex_.emplace(condition->intVal, workStatus->workKey_);
+            break;
+        case WorkCondition::Type::NETWORK:
+            networkIndex_[condition->enumVal].insert(workStatus->workKey_);
+            break;
+        case WorkCondition::Type::CHARGER:
+            chargerIndex_[GetChargerBucket(condition->boolVal, condition->enumVal)]
+                .insert(workStatus->workKey_);
+            break;
+        default:
+            return;
+    }
+    pendingWorks_[type].insert(workStatus->workKey_);
+}
+
+void WorkQueueManager::RemoveFromConditionIndex(WorkCondition::Type type, const shared_ptr<WorkStatus> &workStatus)
+{
+    const auto &condition = workStatus->workInfo_->GetCondition(type);
+    if (!condition) {
+        return;
+    }
+    switch (type) {
+        case WorkCondition::Type::BATTERY_LEVEL: {
+            auto range = batteryLevelIndex_.equal_range(condition->intVal);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == workStatus->workKey_) {
+                    batteryLevelIndex_.erase(it);
+                    break;
+                }
             }
-            if (!work->IsRepeating() && !work->HasTimeout()) {
-                continue;
+            break;
+        }
+        case WorkCondition::Type::NETWORK: {
+            auto bucket = networkIndex_.find(condition->enumVal);
+            if (bucket != networkIndex_.end()) {
+                bucket->second.erase(workStatus->workKey_);
+            }
+            break;
+        }
+        case WorkCondition::Type::CHARGER: {
+            auto bucket = chargerIndex_.find(GetChargerBucket(condition->boolVal, condition->enumVal));
+            if (bucket != chargerIndex_.end()) {
+                bucket->second.erase(workStatus->workKey_);
+            }
+            break;
+        }
+        default:
+            return;
+    }
+    auto pending = pendingWorks_.find(type);
+    if (pending != pendingWorks_.end()) {
+        pending->second.erase(workStatus->workKey_);
+    }
+}
+
+bool WorkQueueManager::GetConditionCandidates(WorkCondition::Type type, const shared_ptr<DetectorValue> &conditionVal,
+    std::unordered_set<WorkKey, WorkKeyHash> &candidates)
+{
+    if (!conditionVal || (type != WorkCondition::Type::BATTERY_LEVEL && type != WorkCondition::Type::NETWORK &&
+        type != WorkCondition::Type::CHARGER)) {
+        return false;
+    }
+    shared_ptr<DetectorValue> lastVal = nullptr;
+    auto lastIter = lastConditionVal_.find(type);
+    if (lastIter != lastConditionVal_.end()) {
+        lastVal = lastIter->second;
+    }
+    lastConditionVal_[type] = make_shared<DetectorValue>(*conditionVal);
+    candidates.swap(pendingWorks_[type]);
+    pendingWorks_[type].clear();
+    if (!lastVal) {
+        return false;
+    }
+    switch (type) {
+        case WorkCondition::Type::BATTERY_LEVEL: {
+            // a work with required level r is ready iff r <= level, so only r in (low, high] flips.
+            auto begin = batteryLevelIndex_.upper_bound(std::min(lastVal->intVal, conditionVal->intVal));
+            auto end = batteryLevelIndex_.upper_bound(std::max(lastVal->intVal, conditionVal->intVal));
+            for (auto it = begin; it != end; ++it) {
+                candidates.insert(it->second);
+            }
+            break;
+        }
+        case WorkCondition::Type::NETWORK:
+            CollectBucketWorks(GetReadyNetworkBuckets(lastVal->intVal), GetReadyNetworkBuckets(conditionVal->intVal),
+                networkIndex_, candidates);
+            break;
+        case WorkCondition::Type::CHARGER:
+            CollectBucketWorks(GetReadyChargerBuckets(lastVal->boolVal, lastVal->intVal),
+                GetReadyChargerBuckets(conditionVal->boolVal, conditionVal->intVal), chargerIndex_, candidates);
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+void WorkQueueManager::CollectBucketWorks(const std::set<int32_t> &lastBuckets, const std::set<int32_t> &newBuckets,
+    const std::map<int32_t, std::unordered_set<WorkKey, WorkKeyHash>> &index,
+    std::unordered_set<WorkKey, WorkKeyHash> &candidates)
+{
+    std::vector<int32_t> flippedBuckets;
+    std::set_symmetric_difference(lastBuckets.begin(), lastBuckets.end(), newBuckets.begin(), newBuckets.end(),
+        std::back_inserter(flippedBuckets));
+    for (int32_t bucket : flippedBuckets) {
+        auto works = index.find(bucket);
+        if (works != index.end()) {
+            candidates.insert(works->second.begin(), works->second.end());
+        }
+    }
+}
+
+void WorkQueueManager::ClearTimeOutWorkStatus()
+{
+    // running non-repeating works only time out by watchdog, probe them once the earliest deadline passed.
+    // called by GetReayQueue under mutex_, so the probe never overlaps the judge of a queue.
+    if (WorkStatus::TakeDueTimeoutDeadline(WorkSchedUtils::GetCurrentTimeMs())) {
+        workRegistry_->ForEach([](const shared_ptr<WorkStatus> &work) {
+            if (work->IsRepeating() || work->HasTimeout()) {
+                return;
             }
-            if (allWorkIds.count(work->workId_) != 0) {
-                continue;
+            if (work->IsRunning() && !work->IsPaused()) {
+                work->ArmTimeoutDeadline();
             }
-            allWorkIds.insert(work->workId_);
-            WS_HILOGE("work timed out and will be ended, bundleName:%{public}s, workId:%{public}s",
-                work->bundleName_.c_str(), work->workId_.c_str());
-            AsyncStopWork(work);
+        });
+    }
+    auto timeoutWorks = WorkStatus::TakeTimeoutWorks();
+    for (const auto &workKey : timeoutWorks) {
+        auto work = workRegistry_->Find(workKey);
+        if (!work || !work->IsTimeout()) {
+            continue;
         }
+        WS_HILOGE("work timed out and will be ended, bundleName:%{public}s, workId:%{public}s",
+            work->bundleName_.c_str(), work->workId_.c_str());
+        AsyncStopWork(work);
     }
 }
 
 void WorkQueueManager::PrintWorkStatus(WorkCondition::Type conditionType)
 {
+    if (!printWorkStatus_) {
+        uint64_t now = WorkSchedUtils::GetCurrentTimeMs();
+        std::lock_guard<ffrt::mutex> lock(printMutex_);
+        auto iter = lastPrintTime_.find(conditionType);
+        if (iter != lastPrintTime_.end() && now - iter->second < PRINT_WORK_STATUS_INTERVAL_MS) {
+            return;
+        }
+        lastPrintTime_[conditionType] = now;
+    }
     if (conditionType == WorkCondition::Type::GROUP || conditionType == WorkCondition::Type::STANDBY) {
         PrintAllWorkStatus(conditionType);
         return;
     }
     if (queueMap_.count(conditionType) > 0) {
         shared_ptr<WorkQueue> workQueue = queueMap_.at(conditionType);
-        auto workList = workQueue->GetWorkList();
-        for (auto work : workList) {
+        auto works = workQueue->GetSnapshot();
+        for (const auto &work : *works) {
             work->ToString(conditionType);
         }
     }
@@ -189,37 +407,98 @@ void WorkQueueManager::PrintWorkStatus(WorkCondition::Type conditionType)
 
 void WorkQueueManager::PrintAllWorkStatus(WorkCondition::Type conditionType)
 {
-    std::set<std::string> allWorkIds;
-    for (auto it : queueMap_) {
-        shared_ptr<WorkQueue> workQueue = it.second;
-        auto workList = workQueue->GetWorkList();
-        for (auto work : workList) {
-            if (allWorkIds.count(work->workId_) != 0) {
-                continue;
-            }
-            allWorkIds.insert(work->workId_);
-            work->ToString(conditionType);
-        }
+    auto works = workRegistry_->GetSnapshot();
+    for (const auto &work : *works) {
+        work->ToString(conditionType);
     }
 }
 
-void WorkQueueManager::PushWork(vector<shared_ptr<WorkStatus>> &works, vector<shared_ptr<WorkStatus>> &result)
+void WorkQueueManager::OnConditionChanged(WorkCondition::Type conditionType,
+    shared_ptr<DetectorValue> conditionVal)
 {
-    for (const auto &work : works) {
-        auto iter = std::find_if(result.begin(), result.end(),
-        [&](const auto &existingWork) {
-            return existingWork->workId_ == work->workId_;
+    auto service = wss_.lock();
+    if (!service) {
+        WS_HILOGE("service is null");
+        return;
+    }
+    auto handler = service->GetHandler();
+    if (!handler) {
+        WS_HILOGE("handler is null");
+        return;
+    }
+    int64_t windowMs = coalesceWindowMs_.load();
+    if (windowMs <= 0 || !IsCoalescedType(conditionType)) {
+        handler->PostTask([weak = weak_from_this(), conditionType, conditionVal]() {
+            auto strong = weak.lock();
+            if (!strong) {
+                WS_HILOGE("strong is null");
+                return;
+            }
+            strong->HandleConditionChanged(conditionType, conditionVal);
         });
-        if (iter != result.end()) {
-            WS_HILOGE("WorkId:%{public}s existing, bundleName:%{public}s",
-                work->workId_.c_str(), work->bundleName_.c_str());
-            continue;
+        return;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(coalesceMutex_);
+        auto iter = coalescedConditionVal_.find(conditionType);
+        if (iter != coalescedConditionVal_.end()) {
+            // the window of this type is open, the latest value is judged when it ends.
+            iter->second = conditionVal;
+            WS_HILOGD("coalesce condition event, type:%{public}d", conditionType);
+            return;
         }
-        result.push_back(work);
+        coalescedConditionVal_.emplace(conditionType, nullptr);
     }
+    // the first event of a window is judged at once, only the ones following it are merged.
+    handler->PostTask([weak = weak_from_this(), conditionType, conditionVal]() {
+        auto strong = weak.lock();
+        if (!strong) {
+            WS_HILOGE("strong is null");
+            return;
+        }
+        strong->HandleConditionChanged(conditionType, conditionVal);
+    });
+    PostCoalesceWindowEnd(conditionType, windowMs);
 }
 
-void WorkQueueManager::OnConditionChanged(WorkCondition::Type conditionType,
+void WorkQueueManager::PostCoalesceWindowEnd(WorkCondition::Type conditionType, int64_t windowMs)
+{
+    auto service = wss_.lock();
+    auto handler = service ? service->GetHandler() : nullptr;
+    if (!handler) {
+        WS_HILOGE("handler is null, close the window");
+        std::lock_guard<ffrt::mutex> lock(coalesceMutex_);
+        coalescedConditionVal_.erase(conditionType);
+        return;
+    }
+    handler->PostTask([weak = weak_from_this(), conditionType, windowMs]() {
+        auto strong = weak.lock();
+        if (!strong) {
+            WS_HILOGE("strong is null");
+            return;
+        }
+        shared_ptr<DetectorValue> latestVal;
+        {
+            std::lock_guard<ffrt::mutex> lock(strong->coalesceMutex_);
+            auto iter = strong->coalescedConditionVal_.find(conditionType);
+            if (iter == strong->coalescedConditionVal_.end()) {
+                return;
+            }
+            if (iter->second == nullptr) {
+                // no event followed the judged one, the next event is judged at once.
+                strong->coalescedConditionVal_.erase(iter);
+                return;
+            }
+            latestVal = iter->second;
+            iter->second = nullptr;
+        }
+        strong->HandleConditionChanged(conditionType, latestVal);
+        // events of a burst keep being merged until a whole window passes without one.
+        strong->PostCoalesceWindowEnd(conditionType, windowMs);
+    }, windowMs);
+}
+
+void WorkQueueManager::HandleConditionChanged(WorkCondition::Type conditionType,
     shared_ptr<DetectorValue> conditionVal)
 {
     auto service = wss_.lock();
@@ -227,23 +506,60 @@ void WorkQueueManager::OnConditionChanged(WorkCondition::Type conditionType,
         WS_HILOGE("service is null");
         return;
     }
-    auto task = [weak = weak_from_this(), service, conditionType, conditionVal]() {
+    vector<shared_ptr<WorkStatus>> readyWorkVector = GetReayQueue(conditionType, conditionVal);
+    if (readyWorkVector.size() == 0) {
+        return;
+    }
+    for (auto it : readyWorkVector) {
+        it->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        if (it->workInfo_->IsCallBySystemApp()) {
+            it->workInfo_->SetTriggerType(conditionType);
+            WS_HILOGD("set trigger type for readyWork, WorkId:%{public}s, bundleName:%{public}s, type:%{public}d",
+                it->workId_.c_str(), it->bundleName_.c_str(), conditionType);
+        }
+    }
+    service->OnConditionReady(make_shared<vector<shared_ptr<WorkStatus>>>(readyWorkVector));
+}
+
+bool WorkQueueManager::IsCoalescedType(WorkCondition::Type conditionType)
+{
+    // only state conditions, where the latest value supersedes the earlier ones.
+    switch (conditionType) {
+        case WorkCondition::Type::NETWORK:
+        case WorkCondition::Type::CHARGER:
+        case WorkCondition::Type::BATTERY_STATUS:
+        case WorkCondition::Type::BATTERY_LEVEL:
+        case WorkCondition::Type::STORAGE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void WorkQueueManager::SetCoalesceWindow(int64_t windowMs)
+{
+    coalesceWindowMs_ = windowMs;
+}
+
+void WorkQueueManager::OnUriKeySwitchChanged(const std::string &uriKey)
+{
+    auto service = wss_.lock();
+    if (!service) {
+        WS_HILOGE("service is null");
+        return;
+    }
+    auto task = [weak = weak_from_this(), service, uriKey]() {
         auto strong = weak.lock();
         if (!strong) {
             WS_HILOGE("strong is null");
             return;
         }
-        vector<shared_ptr<WorkStatus>> readyWorkVector = strong->GetReayQueue(conditionType, conditionVal);
+        vector<shared_ptr<WorkStatus>> readyWorkVector = strong->GetReadyWorksByUriKey(uriKey);
         if (readyWorkVector.size() == 0) {
             return;
         }
         for (auto it : readyWorkVector) {
             it->MarkStatus(WorkStatus::Status::CONDITION_READY);
-            if (it->workInfo_->IsCallBySystemApp()) {
-                it->workInfo_->SetTriggerType(conditionType);
-                WS_HILOGD("set trigger type for readyWork, WorkId:%{public}s, bundleName:%{public}s, type:%{public}d",
-                    it->workId_.c_str(), it->bundleName_.c_str(), conditionType);
-            }
         }
         service->OnConditionReady(make_shared<vector<shared_ptr<WorkStatus>>>(readyWorkVector));
     };
@@ -265,7 +581,7 @@ bool WorkQueueManager::StopAndClearWorks(list<shared_ptr<WorkStatus>> workList)
 
 void WorkQueueManager::Dump(string& result)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
     string conditionType[] = {"network", "charger", "battery_status", "battery_level",
         "storage", "timer", "group", "deepIdle", "standby", "unknown"};
     uint32_t size = sizeof(conditionType) / sizeof(conditionType[0]);
@@ -311,10 +627,8 @@ int32_t WorkQueueManager::GetTimeRetrigger()
 
 void WorkQueueManager::SetMinIntervalByDump(int64_t interval)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto it : queueMap_) {
-        it.second->SetMinIntervalByDump(interval);
-    }
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::QUEUE_MANAGER);
+    workRegistry_->SetMinIntervalByDump(interval);
 }
 
 void WorkQueueManager::AsyncStopWork(std::shared_ptr<WorkStatus> workStatus)
@@ -28,10 +28,11 @@ const std::string PRINSTALLED_WORKS_KEY = "work_scheduler_preinstalled_works";
 const std::string ACTIVE_GROUP_WHITELIST = "active_group_whitelist";
 const std::string MIN_REPEAT_TIME_KEY = "work_scheduler_min_repeat_time";
 const std::string EXEMPTION_BUNDLES_KEY = "work_scheduler_eng_exemption_bundles";
+const std::string WEIGHTED_POLICY_KEY = "work_scheduler_weighted_policy";
 }
 void WorkSchedulerConfig::InitActiveGroupWhitelist(const std::string &configData)
 {
-    std::lock_guard<std::mutex> lock(configMutex_);
+    std::unique_lock<ffrt::shared_mutex> lock(configMutex_);
     const nlohmann::json &jsonObj = nlohmann::json::parse(configData, nullptr, false);
     if (jsonObj.is_discarded()) {
         WS_HILOGE("jsonObj parse fail");
@@ -127,6 +128,20 @@ void WorkSchedulerConfig::UpdateCloudConfigPrinstalledWorkKey(const nlohmann::js
     DelayedSingleton<WorkSchedulerService>::GetInstance()->UpdateCloudConfigPrinstalledWorkKey(preinstalledWorksRoot);
 }
 
+void WorkSchedulerConfig::UpdateCloudConfigWeightedPolicy(const nlohmann::json &root)
+{
+    if (!root.contains(WEIGHTED_POLICY_KEY)) {
+        WS_HILOGE("no work_scheduler_weighted_policy key");
+        return;
+    }
+    nlohmann::json weightedPolicyRoot = root[WEIGHTED_POLICY_KEY];
+    if (weightedPolicyRoot.empty() || !weightedPolicyRoot.is_object()) {
+        WS_HILOGE("work_scheduler_weighted_policy content is empty");
+        return;
+    }
+    DelayedSingleton<WorkSchedulerService>::GetInstance()->UpdateCloudConfigWeightedPolicy(weightedPolicyRoot);
+}
+
 bool WorkSchedulerConfig::UpdateSusMgrCloudConfig(const nlohmann::json &payload)
 {
     nlohmann::json workSchedulerParam;
@@ -140,8 +155,9 @@ bool WorkSchedulerConfig::UpdateSusMgrCloudConfig(const nlohmann::json &payload)
     }
     // 延迟任务活跃分组
     nlohmann::json activeGroupWhiteList = workSchedulerParam[ACTIVE_GROUP_WHITELIST];
-    std::lock_guard<std::mutex> lock(configMutex_);
+    std::unique_lock<ffrt::shared_mutex> lock(configMutex_);
     activeGroupWhitelist_.clear();
+    signatureCache_.clear();
     for (const auto &app : activeGroupWhiteList) {
         if (!app.is_string()) {
             continue;
@@ -157,13 +173,28 @@ bool WorkSchedulerConfig::UpdateSusMgrCloudConfig(const nlohmann::json &payload)
 bool WorkSchedulerConfig::IsInActiveGroupWhitelist(const std::string &bundleName)
 {
     {
-        std::lock_guard<std::mutex> lock(configMutex_);
+        std::shared_lock<ffrt::shared_mutex> lock(configMutex_);
         if (!activeGroupWhitelist_.count(bundleName)) {
             return false;
         }
+        auto iter = signatureCache_.find(bundleName);
+        if (iter != signatureCache_.end()) {
+            return iter->second;
+        }
+    }
+    bool checkOk = ResourceSchedule::ResSchedSignatureValidator::GetInstance().CheckSignatureByBundleName(bundleName) ==
+        ResourceSchedule::SignatureCheckResult::CHECK_OK;
+    std::unique_lock<ffrt::shared_mutex> lock(configMutex_);
+    if (activeGroupWhitelist_.count(bundleName)) {
+        signatureCache_[bundleName] = checkOk;
     }
-    return ResourceSchedule::ResSchedSignatureValidator::GetInstance().CheckSignatureByBundleName(bundleName) ==
-           ResourceSchedule::SignatureCheckResult::CHECK_OK;
+    return checkOk;
+}
+
+void WorkSchedulerConfig::ClearSignatureCache(const std::string &bundleName)
+{
+    std::unique_lock<ffrt::shared_mutex> lock(configMutex_);
+    signatureCache_.erase(bundleName);
 }
 
 bool WorkSchedulerConfig::UpdateBgMgrCloudConfig(const nlohmann::json &payload)
@@ -178,6 +209,8 @@ bool WorkSchedulerConfig::UpdateBgMgrCloudConfig(const nlohmann::json &payload)
     UpdateCloudConfigEngExemptionBundles(workSchedulerParam);
     // 延迟任务系统预置应用、延迟任务拉起SA
     UpdateCloudConfigPrinstalledWorkKey(workSchedulerParam);
+    // 延迟任务按开销准入
+    UpdateCloudConfigWeightedPolicy(workSchedulerParam);
     return true;
 }
 } // WorkScheduler
@@ -43,6 +43,40 @@ void DataManager::SetDeepIdle(const bool isDeepIdle)
     deepIdle_ = isDeepIdle;
 }
 
+int32_t DataManager::GetChargerType() const
+{
+    if (!chargerSubscribed_) {
+        return WorkCondition::Charger::CHARGING_UNKNOWN;
+    }
+    return chargerType_;
+}
+
+void DataManager::SetChargerSubscribed(const bool isSubscribed)
+{
+    chargerSubscribed_ = isSubscribed;
+    if (!isSubscribed) {
+        // no event updates the type any more, forget it so that readers query again.
+        chargerType_ = WorkCondition::Charger::CHARGING_UNKNOWN;
+    }
+}
+
+void DataManager::SetChargerType(const int32_t chargerType)
+{
+    if (!chargerSubscribed_) {
+        return;
+    }
+    chargerType_ = chargerType;
+}
+
+void DataManager::InitChargerType(const int32_t chargerType)
+{
+    if (!chargerSubscribed_) {
+        return;
+    }
+    int32_t expected = WorkCondition::Charger::CHARGING_UNKNOWN;
+    chargerType_.compare_exchange_strong(expected, chargerType);
+}
+
 bool DataManager::IsInDeviceStandyWhitelist(const std::string& bundleName)
 {
     std::lock_guard<ffrt::mutex> lock(deviceStandySetMutex_);
@@ -149,5 +183,52 @@ void DataManager::ClearAllGroup()
     std::lock_guard<ffrt::mutex> lock(activeGroupMapMutex_);
     activeGroupMap_.clear();
 }
+
+bool DataManager::FindMailApp(const std::string& bundleName, bool& isMailApp)
+{
+    std::lock_guard<ffrt::mutex> lock(mailAppMapMutex_);
+    auto iter = mailAppMap_.find(bundleName);
+    if (iter == mailAppMap_.end()) {
+        return false;
+    }
+    isMailApp = iter->second;
+    return true;
+}
+
+void DataManager::AddMailApp(const std::string& bundleName, const bool isMailApp)
+{
+    std::lock_guard<ffrt::mutex> lock(mailAppMapMutex_);
+    mailAppMap_[bundleName] = isMailApp;
+}
+
+void DataManager::ClearMailApp(const std::string& bundleName)
+{
+    std::lock_guard<ffrt::mutex> lock(mailAppMapMutex_);
+    mailAppMap_.erase(bundleName);
+}
+
+bool DataManager::RefreshActiveUsers()
+{
+    std::vector<int32_t> userIds;
+    if (!WorkSchedUtils::GetActiveAccountIds(userIds)) {
+        return false;
+    }
+    std::atomic_store(&activeUsers_,
+        std::shared_ptr<const std::set<int32_t>>(std::make_shared<std::set<int32_t>>(userIds.begin(), userIds.end())));
+    WS_HILOGI("active users size %{public}zu", userIds.size());
+    return true;
+}
+
+bool DataManager::IsUserActive(const int32_t userId)
+{
+    auto activeUsers = std::atomic_load(&activeUsers_);
+    if (activeUsers == nullptr) {
+        if (!RefreshActiveUsers()) {
+            return false;
+        }
+        activeUsers = std::atomic_load(&activeUsers_);
+    }
+    return activeUsers->count(userId) > 0;
+}
 } // namespace WorkScheduler
 } // namespace OHOS
\ No newline at end of file
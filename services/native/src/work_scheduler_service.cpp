@@ -68,6 +68,7 @@
 #include "work_sched_plugin_mgr.h"
 #endif
 #include "work_datashare_helper.h"
+#include "work_lock_order.h"
 #include "work_scheduler_connection.h"
 #include "work_bundle_group_change_callback.h"
 #include "work_sched_errors.h"
@@ -126,6 +127,8 @@ const char* PREINSTALLED_FILE_PATH = "etc/backgroundtask/config.json";
 const char* BACKGROUND_LOADER_FILE_PATH = "/system/variant/phone/base/etc/backgroundtask/config.json";
 const char* PERSISTED_INFO_FILE_NAME = "/persisted_info";
 const char* PERSISTED_INFO_FILE_PATH = "/data/service/el1/public/WorkScheduler/persisted_info";
+const char* EXEC_HISTORY_FILE_NAME = "/exec_history";
+const char* EXEC_HISTORY_FILE_PATH = "/data/service/el1/public/WorkScheduler/exec_history";
 #ifdef DEVICE_USAGE_STATISTICS_ENABLE
 static int g_hasGroupObserver = -1;
 #endif
@@ -177,6 +180,13 @@ void WorkSchedulerService::OnStart()
 #endif
 #ifdef DEVICE_STANDBY_ENABLE
     AddSystemAbilityListener(DEVICE_STANDBY_SERVICE_SYSTEM_ABILITY_ID);
+#endif
+    AddSystemAbilityListener(DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID);
+#ifdef POWERMGR_THERMAL_MANAGER_ENABLE
+    AddSystemAbilityListener(POWER_MANAGER_THERMAL_SERVICE_ID);
+#endif
+#ifdef POWERMGR_POWER_MANAGER_ENABLE
+    AddSystemAbilityListener(POWER_MANAGER_SERVICE_ID);
 #endif
     WS_HILOGD("On start success.");
 }
@@ -215,8 +225,11 @@ WEAK_FUNC bool WorkSchedulerService::IsBaseAbilityReady()
 void WorkSchedulerService::InitPersistedWork()
 {
     WS_HILOGD("init persisted work");
-    std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-    list<shared_ptr<WorkInfo>> persistedWorks = ReadPersistedWorks();
+    list<shared_ptr<WorkInfo>> persistedWorks;
+    {
+        OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+        persistedWorks = ReadPersistedWorks();
+    }
     for (auto it : persistedWorks) {
         WS_HILOGI("get persisted work, id: %{public}d, isSa:%{public}d", it->GetWorkId(), it->IsSA());
         AddWorkInner(*it);
@@ -228,6 +241,13 @@ void WorkSchedulerService::InitPreinstalledWork()
 {
     WS_HILOGD("init preinstalled work");
     list<shared_ptr<WorkInfo>> preinstalledWorks = ReadPreinstalledWorks();
+    std::set<std::string> uriKeys;
+    for (auto work : preinstalledWorks) {
+        if (!work->GetUriKey().empty()) {
+            uriKeys.insert(work->GetUriKey());
+        }
+    }
+    WorkDatashareHelper::GetInstance().PreloadSwitches(std::vector<std::string>(uriKeys.begin(), uriKeys.end()));
     for (auto work : preinstalledWorks) {
         WS_HILOGI("preinstalled workinfo id %{public}s, isSa:%{public}d", work->GetBriefInfo().c_str(), work->IsSA());
         time_t baseTime;
@@ -235,9 +255,8 @@ void WorkSchedulerService::InitPreinstalledWork()
         work->RequestBaseTime(baseTime);
         AddWorkInner(*work);
         if (work->IsPersisted()) {
-            string workId = "u" + to_string(work->GetUid()) + "_" + to_string(work->GetWorkId());
-            std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-            persistedMap_.emplace(workId, work);
+            OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+            persistedMap_.emplace(WorkStatus::MakeWorkKey(work->GetWorkId(), work->GetUid()), work);
         }
     }
     uint32_t minCheckTime = GetMinCheckTime();
@@ -251,6 +270,7 @@ void WorkSchedulerService::InitWorkInner()
     InitPreinstalledWork();
     InitPersistedWork();
     InitPersistedInfos();
+    InitExecHistory();
 }
 
 list<shared_ptr<WorkInfo>> WorkSchedulerService::ReadPersistedWorks()
@@ -272,18 +292,15 @@ list<shared_ptr<WorkInfo>> WorkSchedulerService::ReadPersistedWorks()
         }
         workInfos.emplace_back(workInfo);
         WS_HILOGI("find one persisted work %{public}s", workInfo->GetBriefInfo().c_str());
-        auto iter = std::find_if(persistedMap_.begin(), persistedMap_.end(), [&](const auto &pair) {
-            return (pair.second->GetUid() == workInfo->GetUid()) && (pair.second->GetWorkId() == workInfo->GetWorkId());
-        });
-        if (iter != persistedMap_.end()) {
+        WorkKey workKey = WorkStatus::MakeWorkKey(workInfo->GetWorkId(), workInfo->GetUid());
+        if (persistedMap_.count(workKey) != 0) {
             WS_HILOGI("find work %{public}s in persisted map, ignore, isSA:%{public}d",
                 workInfo->GetBriefInfo().c_str(),
                 workInfo->IsSA());
             // update basetime
             continue;
         }
-        string workId = "u" + to_string(workInfo->GetUid()) + "_" + to_string(workInfo->GetWorkId());
-        persistedMap_.emplace(workId, workInfo);
+        persistedMap_.emplace(workKey, workInfo);
     }
     return workInfos;
 }
@@ -498,6 +515,10 @@ void WorkSchedulerService::OnStop()
     DevStandbyMgr::StandbyServiceClient::GetInstance().UnsubscribeStandbyCallback(standbyStateObserver_);
     standbyStateObserver_ = nullptr;
 #endif
+    // the runs recorded since the last persist would be lost with the pending task.
+    if (workPolicyManager_ != nullptr && workPolicyManager_->GetExecHistory()->IsDirty()) {
+        RefreshExecHistory();
+    }
     eventRunner_.reset();
     handler_.reset();
     ready_.store(false);
@@ -511,6 +532,7 @@ bool WorkSchedulerService::Init(const std::shared_ptr<AppExecFwk::EventRunner>&
         GetHandler()->SendEvent(InnerEvent::Get(WorkEventHandler::SERVICE_INIT_MSG, 0), INIT_DELAY);
         return false;
     }
+    DelayedSingleton<DataManager>::GetInstance()->RefreshActiveUsers();
     WorkQueueManagerInit(runner);
     if (!WorkPolicyManagerInit(runner)) {
         WS_HILOGE("init failed due to work policy manager init.");
@@ -580,6 +602,13 @@ void WorkSchedulerService::WorkQueueManagerInit(const std::shared_ptr<AppExecFwk
     if (workQueueManager_ == nullptr) {
         workQueueManager_ = make_shared<WorkQueueManager>(instance);
     }
+    WorkDatashareHelper::GetInstance().SetSwitchChangedCallback(
+        [weak = std::weak_ptr<WorkQueueManager>(workQueueManager_)](const std::string &uriKey) {
+            auto manager = weak.lock();
+            if (manager) {
+                manager->OnUriKeySwitchChanged(uriKey);
+            }
+        });
 
     auto networkListener = make_shared<NetworkListener>(workQueueManager_);
 #ifdef POWERMGR_BATTERY_MANAGER_ENABLE
@@ -623,8 +652,9 @@ bool WorkSchedulerService::WorkPolicyManagerInit(const std::shared_ptr<AppExecFw
     }
 
 #ifdef POWERMGR_THERMAL_MANAGER_ENABLE
-    auto thermalFilter = make_shared<ThermalPolicy>(workPolicyManager_);
-    workPolicyManager_->AddPolicyFilter(thermalFilter);
+    thermalFilter_ = make_shared<ThermalPolicy>(workPolicyManager_);
+    thermalFilter_->Subscribe();
+    workPolicyManager_->AddPolicyFilter(thermalFilter_);
 #endif // POWERMGR_THERMAL_MANAGER_ENABLE
     auto memoryFilter = make_shared<MemoryPolicy>(workPolicyManager_);
     workPolicyManager_->AddPolicyFilter(memoryFilter);
@@ -633,8 +663,9 @@ bool WorkSchedulerService::WorkPolicyManagerInit(const std::shared_ptr<AppExecFw
     workPolicyManager_->AddPolicyFilter(cpuFilter);
 
 #ifdef POWERMGR_POWER_MANAGER_ENABLE
-    auto powerModeFilter = make_shared<PowerModePolicy>(workPolicyManager_);
-    workPolicyManager_->AddPolicyFilter(powerModeFilter);
+    powerModeFilter_ = make_shared<PowerModePolicy>(workPolicyManager_);
+    powerModeFilter_->Subscribe();
+    workPolicyManager_->AddPolicyFilter(powerModeFilter_);
 #endif
 
     auto appDataClearListener = make_shared<AppDataClearListener>(workPolicyManager_);
@@ -779,10 +810,10 @@ int32_t WorkSchedulerService::StartWorkInner(const WorkInfo& workInfo, int32_t u
     if (ret == ERR_OK) {
         workQueueManager_->AddWork(workStatus);
         if (workInfo_.IsPersisted()) {
-            std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
+            OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
             workStatus->workInfo_->RefreshUid(uid);
-            persistedMap_.emplace(workStatus->workId_, workStatus->workInfo_);
-            RefreshPersistedWorks();
+            persistedMap_.emplace(workStatus->workKey_, workStatus->workInfo_);
+            RefreshPersistedWorksLocked();
         }
         GetHandler()->RemoveEvent(WorkEventHandler::CHECK_CONDITION_MSG);
         GetHandler()->SendEvent(InnerEvent::Get(WorkEventHandler::CHECK_CONDITION_MSG, 0),
@@ -892,9 +923,9 @@ int32_t WorkSchedulerService::StopAndCancelWork(const WorkInfo& workInfo)
     }
     StopWorkInner(workStatus, uid, true, false);
     if (workStatus->persisted_) {
-        std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-        persistedMap_.erase(workStatus->workId_);
-        RefreshPersistedWorks();
+        OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+        persistedMap_.erase(workStatus->workKey_);
+        RefreshPersistedWorksLocked();
     }
     WS_HILOGI("StopAndCancelWork %{public}s workId:%{public}d",
         workInfo_.GetBundleName().c_str(), workInfo_.GetWorkId());
@@ -934,19 +965,17 @@ bool WorkSchedulerService::StopAndClearWorksByUid(int32_t uid)
 {
     WS_HILOGD("Stop and clear works by Uid:%{public}d", uid);
     list<std::shared_ptr<WorkStatus>> allWorks = workPolicyManager_->GetAllWorkStatus(uid);
-    list<std::string> workIdList;
-    std::transform(allWorks.cbegin(), allWorks.cend(), std::back_inserter(workIdList),
-        [](std::shared_ptr<WorkStatus> work) { return work->workId_; });
+    list<WorkKey> workKeyList;
+    std::transform(allWorks.cbegin(), allWorks.cend(), std::back_inserter(workKeyList),
+        [](std::shared_ptr<WorkStatus> work) { return work->workKey_; });
     bool ret = workQueueManager_->StopAndClearWorks(allWorks)
         && workPolicyManager_->StopAndClearWorks(uid);
     if (ret) {
-        std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-        for (auto workId : workIdList) {
-            if (persistedMap_.count(workId) != 0) {
-                persistedMap_.erase(workId);
-            }
+        OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+        for (const auto &workKey : workKeyList) {
+            persistedMap_.erase(workKey);
         }
-        RefreshPersistedWorks();
+        RefreshPersistedWorksLocked();
     }
     return ret;
 }
@@ -1043,9 +1072,9 @@ void WorkSchedulerService::UpdateWorkBeforeRealStart(std::shared_ptr<WorkStatus>
     if (work->NeedRemove()) {
         workQueueManager_->RemoveWork(work);
         if (work->persisted_ && !work->IsRepeating()) {
-            std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-            persistedMap_.erase(work->workId_);
-            RefreshPersistedWorks();
+            OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+            persistedMap_.erase(work->workKey_);
+            RefreshPersistedWorksLocked();
         }
     }
 }
@@ -1367,9 +1396,14 @@ void WorkSchedulerService::DumpParamRestore(std::string &result)
 }
 
 void WorkSchedulerService::RefreshPersistedWorks()
+{
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+    RefreshPersistedWorksLocked();
+}
+
+void WorkSchedulerService::RefreshPersistedWorksLocked()
 {
     nlohmann::json root;
-    std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
     for (auto &it : persistedMap_) {
         if (it.second == nullptr) {
             WS_HILOGE("workInfo is nullptr");
@@ -1379,7 +1413,7 @@ void WorkSchedulerService::RefreshPersistedWorks()
         string data = workInfo->ParseToJsonStr();
         const nlohmann::json &workJson = nlohmann::json::parse(data, nullptr, false);
         if (!workJson.is_discarded()) {
-            root[it.first] = workJson;
+            root[it.first.ToString()] = workJson;
         }
     }
     string result = root.dump(4);
@@ -1511,6 +1545,16 @@ void WorkSchedulerService::OnAddSystemAbility(int32_t systemAbilityId, const std
         InitDeviceStandyRestrictlist();
         RegisterStandbyStateObserver();
     }
+#ifdef POWERMGR_THERMAL_MANAGER_ENABLE
+    if (systemAbilityId == POWER_MANAGER_THERMAL_SERVICE_ID && thermalFilter_) {
+        thermalFilter_->Subscribe();
+    }
+#endif
+#ifdef POWERMGR_POWER_MANAGER_ENABLE
+    if (systemAbilityId == POWER_MANAGER_SERVICE_ID && powerModeFilter_) {
+        powerModeFilter_->Subscribe();
+    }
+#endif
 }
 
 void WorkSchedulerService::OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
@@ -1533,7 +1577,19 @@ void WorkSchedulerService::OnRemoveSystemAbility(int32_t systemAbilityId, const
         groupObserver_ = nullptr;
         DelayedSingleton<DataManager>::GetInstance()->ClearAllGroup();
 #endif
+    } else if (systemAbilityId == DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID) {
+        WorkDatashareHelper::GetInstance().OnRemoteDied();
+    }
+#ifdef POWERMGR_THERMAL_MANAGER_ENABLE
+    if (systemAbilityId == POWER_MANAGER_THERMAL_SERVICE_ID && thermalFilter_) {
+        thermalFilter_->OnServiceRemoved();
     }
+#endif
+#ifdef POWERMGR_POWER_MANAGER_ENABLE
+    if (systemAbilityId == POWER_MANAGER_SERVICE_ID && powerModeFilter_) {
+        powerModeFilter_->OnServiceRemoved();
+    }
+#endif
 }
 
 #ifdef DEVICE_USAGE_STATISTICS_ENABLE
@@ -2167,10 +2223,10 @@ bool WorkSchedulerService::CheckPreinstalledWorkId(const std::string &workId)
     return deletePreinstalledWorkId_.count(workId) > 0;
 }
 
-void WorkSchedulerService::RemovePersistedMap(const std::string &workId)
+void WorkSchedulerService::RemovePersistedMap(const WorkKey &workKey)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-    persistedMap_.erase(workId);
+    OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+    persistedMap_.erase(workKey);
 }
  
 void WorkSchedulerService::UpdateCloudConfigMinRepeatTime(const nlohmann::json &specialRoot)
@@ -2233,6 +2289,14 @@ void WorkSchedulerService::UpdateCloudConfigEngExemptionBundles(const nlohmann::
     }
 }
 
+void WorkSchedulerService::UpdateCloudConfigWeightedPolicy(const nlohmann::json &weightedPolicyRoot)
+{
+    if (!ready_.load() || workPolicyManager_ == nullptr) {
+        return;
+    }
+    workPolicyManager_->UpdateWeightedPolicyConfig(weightedPolicyRoot);
+}
+
 bool WorkSchedulerService::CheckCloudConfigPreinstallDelete(const nlohmann::json &workJson)
 {
     if (workJson.is_null() || workJson.empty()) {
@@ -2266,7 +2330,7 @@ void WorkSchedulerService::DeleteSaWork(std::shared_ptr<WorkInfo> workinfo)
     std::string workId = WorkStatus::MakeWorkId(workinfo->GetWorkId(), workinfo->GetUid());
     WS_HILOGI("stop could config sa task, workId: %{public}s", workId.c_str());
     if (workStatus->workInfo_->IsPersisted()) {
-        RemovePersistedMap(workId);
+        RemovePersistedMap(workStatus->workKey_);
     }
 }
 
@@ -2297,7 +2361,7 @@ void WorkSchedulerService::DeleteAppWork(std::shared_ptr<WorkInfo> workinfo)
         StopWorkInner(workStatus, workinfo->GetUid(), true, false);
         WS_HILOGI("stop could config app task, workId: %{public}s", workId.c_str());
         if (workStatus->workInfo_->IsPersisted()) {
-            RemovePersistedMap(workId);
+            RemovePersistedMap(workStatus->workKey_);
         }
     } else if (workStatus->GetStatus() == WorkStatus::Status::CONDITION_READY ||
         workStatus->GetStatus() == WorkStatus::Status::RUNNING) {
@@ -2331,7 +2395,7 @@ void WorkSchedulerService::StopCloudConfigWork(const std::string &workId, std::s
     RemovePreinstalledWorkId(workId);
     RemovePreinstalledBundles(workInfo->GetBundleName());
     if (workInfo->IsPersisted()) {
-        RemovePersistedMap(workId);
+        RemovePersistedMap(workStatus->workKey_);
     }
 }
 
@@ -2396,10 +2460,10 @@ void WorkSchedulerService::ReStartCloudConfigPreinstalledWork(std::list<std::sha
         work->RequestBaseTime(baseTime);
         AddWorkInner(*work);
         if (work->IsPersisted()) {
-            std::string workId = WorkStatus::MakeWorkId(work->GetWorkId(), work->GetUid());
-            std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
-            WS_HILOGI("cloud config preinstall workId: %{public}s", workId.c_str());
-            persistedMap_.emplace(workId, work);
+            WorkKey workKey = WorkStatus::MakeWorkKey(work->GetWorkId(), work->GetUid());
+            OrderedLockGuard<ffrt::mutex> lock(mutex_, LockLevel::SERVICE_PERSISTED);
+            WS_HILOGI("cloud config preinstall workId: %{public}s", workKey.ToString().c_str());
+            persistedMap_.emplace(workKey, work);
         }
     }
 }
@@ -2423,7 +2487,7 @@ void WorkSchedulerService::UpdateWorkForCloudConfig(std::shared_ptr<WorkInfo> wo
     WS_HILOGI("UpdateWorkForCloudConfig workId: %{public}s", workId.c_str());
     StopWorkInner(workStatus, uid, true, false);
     if (workStatus->persisted_) {
-        RemovePersistedMap(workId);
+        RemovePersistedMap(workStatus->workKey_);
         RefreshPersistedWorks();
     }
 }
@@ -2804,5 +2868,58 @@ bool WorkSchedulerService::CreateNodePersistedInfoFile()
     WS_HILOGD("Resources created successfully.");
     return true;
 }
+
+void WorkSchedulerService::InitExecHistory()
+{
+    if (access(EXEC_HISTORY_FILE_PATH, F_OK) != 0) {
+        WS_HILOGI("no exec history persisted yet");
+        return;
+    }
+    nlohmann::json root;
+    if (!GetJsonFromFile(EXEC_HISTORY_FILE_PATH, root) || root.is_null() || root.empty()) {
+        WS_HILOGE("ReadExecHistory failed, root is empty or not an object");
+        return;
+    }
+    workPolicyManager_->GetExecHistory()->ParseFromJson(root);
+}
+
+void WorkSchedulerService::RefreshExecHistory()
+{
+    if (workPolicyManager_ == nullptr) {
+        return;
+    }
+    auto execHistory = workPolicyManager_->GetExecHistory();
+    uint64_t seq = 0;
+    std::string result = execHistory->ParseToJsonStr(seq);
+    bool isSuccess = WriteExecHistory(result);
+    execHistory->OnPersisted(seq, isSuccess, WorkSchedUtils::GetCurrentTimeMs());
+}
+
+bool WorkSchedulerService::WriteExecHistory(const std::string &result)
+{
+    if (mkdir(PERSISTED_PATH, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) != 0 && errno != EEXIST) {
+        WS_HILOGE("Create directory failed: %{private}s, errno: %{public}s", PERSISTED_PATH, strerror(errno));
+        return false;
+    }
+    std::string realPath;
+    if (!WorkSchedUtils::ConvertFullPath(PERSISTED_PATH, realPath)) {
+        WS_HILOGE("Get real dir path failed");
+        return false;
+    }
+    ofstream fout;
+    fout.open(realPath + EXEC_HISTORY_FILE_NAME, ios::out | ios::trunc);
+    if (!fout.is_open()) {
+        WS_HILOGE("Fail to open exec history file, errno: %{public}s", strerror(errno));
+        return false;
+    }
+    fout << result.c_str() << endl;
+    fout.close();
+    if (fout.fail()) {
+        WS_HILOGE("Fail to write exec history file, errno: %{public}s", strerror(errno));
+        return false;
+    }
+    WS_HILOGD("Refresh exec history success");
+    return true;
+}
 } // namespace WorkScheduler
 } // namespace OHOS
@@ -52,9 +52,18 @@ std::map<int32_t, time_t> WorkStatus::s_uid_last_time_map;
 const int32_t DEFAULT_PRIORITY = 10000;
 const int32_t HIGH_PRIORITY = 0;
 const int32_t ACTIVE_GROUP = 10;
-const string SWITCH_ON = "1";
 const string DELIMITER = ",";
 ffrt::mutex WorkStatus::s_uid_last_time_mutex;
+ffrt::mutex WorkStatus::s_timeout_works_mutex;
+std::unordered_set<WorkKey, WorkKeyHash> WorkStatus::s_timeout_works;
+std::atomic<uint64_t> WorkStatus::s_timeout_deadline {UINT64_MAX};
+std::atomic<int32_t> WorkStatus::s_running_count {0};
+std::atomic<int32_t> WorkStatus::s_running_cost {0};
+ffrt::mutex WorkStatus::s_running_count_mutex;
+ffrt::mutex WorkStatus::s_active_works_mutex;
+std::unordered_map<WorkKey, int32_t, WorkKeyHash> WorkStatus::s_active_works;
+std::unordered_map<int32_t, int32_t> WorkStatus::s_uid_running_count;
+std::unordered_map<std::string, int32_t> WorkStatus::s_bundle_running_count;
 ffrt::mutex WorkStatus::dumpAppGroupMutex_;
 std::map<int32_t, int32_t> WorkStatus::dumpAppGroupMap_;
 
@@ -130,13 +139,15 @@ WorkStatus::WorkStatus(WorkInfo &workInfo, int32_t uid)
 {
     this->workInfo_ = make_shared<WorkInfo>(workInfo);
     this->workId_ = MakeWorkId(workInfo.GetWorkId(), uid);
+    this->workKey_ = MakeWorkKey(workInfo.GetWorkId(), uid);
+    this->runningCost_ = WORK_COST_UNIT;
     this->bundleName_ = workInfo.GetBundleName();
     this->abilityName_ = workInfo.GetAbilityName();
     this->baseTime_ = workInfo.GetBaseTime();
     this->uid_ = uid;
     this->userId_ = WorkSchedUtils::GetUserIdByUid(uid);
-    if (workInfo.GetConditionMap()->count(WorkCondition::Type::TIMER) > 0) {
-        auto workTimerCondition = workInfo.GetConditionMap()->at(WorkCondition::Type::TIMER);
+    if (workInfo.GetCondition(WorkCondition::Type::TIMER) != nullptr) {
+        const auto &workTimerCondition = workInfo.GetCondition(WorkCondition::Type::TIMER);
         shared_ptr<Condition> timeCondition = make_shared<Condition>();
         timeCondition->uintVal = workTimerCondition->uintVal;
         timeCondition->boolVal = workTimerCondition->boolVal;
@@ -153,23 +164,21 @@ WorkStatus::WorkStatus(WorkInfo &workInfo, int32_t uid)
     this->groupChanged_ = false;
 }
 
-WorkStatus::~WorkStatus() {}
+WorkStatus::~WorkStatus()
+{
+    Status status = currentStatus_.load();
+    if (status == RUNNING) {
+        UpdateRunningCount(-1);
+    }
+    if (status == RUNNING || status == CONDITION_READY) {
+        UpdateActiveWorks(-1);
+    }
+}
 
 int32_t WorkStatus::OnConditionChanged(WorkCondition::Type &type, shared_ptr<Condition> value)
 {
-    conditionStatus_.clear();
-    if (workInfo_->GetConditionMap()->count(type) > 0 &&
-        type != WorkCondition::Type::TIMER &&
-        type != WorkCondition::Type::GROUP) {
-        std::lock_guard<ffrt::mutex> lock(conditionMapMutex_);
-        if (conditionMap_.count(type) > 0 &&
-            type >= WorkCondition::Type::NETWORK &&
-            type <= WorkCondition::Type::UNKNOWN) {
-            conditionMap_.at(type) = value;
-        } else {
-            conditionMap_.emplace(type, value);
-        }
-    }
+    conditionStatus_.Clear();
+    UpdateCondition(type, value);
     if (workInfo_->IsSA()) {
         if (IsSAReady()) {
             MarkStatus(Status::CONDITION_READY);
@@ -196,11 +205,49 @@ int32_t WorkStatus::OnConditionChanged(WorkCondition::Type &type, shared_ptr<Con
     return ERR_OK;
 }
 
+void WorkStatus::UpdateCondition(WorkCondition::Type type, shared_ptr<Condition> value)
+{
+    if ((workInfo_->GetConditionMask() & ConditionSlots::TypeBit(type)) == 0 ||
+        type == WorkCondition::Type::TIMER ||
+        type == WorkCondition::Type::GROUP) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(conditionMapMutex_);
+    // deep idle of one SA is not published as system state, keep it for the work itself.
+    bool isOwnValue = type == WorkCondition::Type::DEEP_IDLE && value && value->enumVal != DEFAULT_SA_ID;
+    if (SystemStateSnapshot::IsSystemState(type) && !isOwnValue) {
+        conditionMap_.erase(type);
+        return;
+    }
+    conditionMap_.Set(type, value);
+}
+
+shared_ptr<Condition> WorkStatus::GetCurrentCondition(WorkCondition::Type type)
+{
+    std::lock_guard<ffrt::mutex> lock(conditionMapMutex_);
+    return GetConditionValue(type, SystemStateSnapshot::GetCurrent());
+}
+
+const shared_ptr<Condition> &WorkStatus::GetConditionValue(WorkCondition::Type type,
+    const shared_ptr<const SystemStateSnapshot> &snapshot) const
+{
+    const auto &value = conditionMap_.at(type);
+    if (value != nullptr || !snapshot || (workInfo_->GetConditionMask() & ConditionSlots::TypeBit(type)) == 0) {
+        return value;
+    }
+    return snapshot->GetCondition(type);
+}
+
 string WorkStatus::MakeWorkId(int32_t workId, int32_t uid)
 {
     return string("u") + to_string(uid) + "_" + to_string(workId);
 }
 
+WorkKey WorkStatus::MakeWorkKey(int32_t workId, int32_t uid)
+{
+    return WorkKey(uid, workId);
+}
+
 void WorkStatus::MarkTimeout()
 {
     lastTimeout_ = true;
@@ -208,7 +255,79 @@ void WorkStatus::MarkTimeout()
 
 void WorkStatus::MarkStatus(Status status)
 {
-    currentStatus_ = status;
+    Status lastStatus = currentStatus_.exchange(status);
+    if (lastStatus != RUNNING && status == RUNNING) {
+        UpdateRunningCount(1);
+    } else if (lastStatus == RUNNING && status != RUNNING) {
+        UpdateRunningCount(-1);
+    }
+    bool wasActive = lastStatus == RUNNING || lastStatus == CONDITION_READY;
+    bool isActive = status == RUNNING || status == CONDITION_READY;
+    if (wasActive != isActive) {
+        UpdateActiveWorks(isActive ? 1 : -1);
+    }
+}
+
+void WorkStatus::UpdateActiveWorks(int32_t delta)
+{
+    std::lock_guard<ffrt::mutex> lock(s_active_works_mutex);
+    if ((s_active_works[workKey_] += delta) <= 0) {
+        s_active_works.erase(workKey_);
+    }
+}
+
+void WorkStatus::GetActiveWorks(std::vector<WorkKey> &workKeys)
+{
+    std::lock_guard<ffrt::mutex> lock(s_active_works_mutex);
+    workKeys.reserve(workKeys.size() + s_active_works.size());
+    for (const auto &[workKey, count] : s_active_works) {
+        workKeys.emplace_back(workKey);
+    }
+}
+
+void WorkStatus::UpdateRunningCount(int32_t delta)
+{
+    s_running_count.fetch_add(delta);
+    s_running_cost.fetch_add(delta * runningCost_.load());
+    std::lock_guard<ffrt::mutex> lock(s_running_count_mutex);
+    if ((s_uid_running_count[uid_] += delta) <= 0) {
+        s_uid_running_count.erase(uid_);
+    }
+    if ((s_bundle_running_count[bundleName_] += delta) <= 0) {
+        s_bundle_running_count.erase(bundleName_);
+    }
+}
+
+int32_t WorkStatus::GetRunningCount()
+{
+    return s_running_count.load();
+}
+
+void WorkStatus::SetRunningCost(int32_t cost)
+{
+    if (currentStatus_.load() == RUNNING) {
+        return;
+    }
+    runningCost_.store(cost);
+}
+
+int32_t WorkStatus::GetRunningCost()
+{
+    return s_running_cost.load();
+}
+
+int32_t WorkStatus::GetUidRunningCount(int32_t uid)
+{
+    std::lock_guard<ffrt::mutex> lock(s_running_count_mutex);
+    auto iter = s_uid_running_count.find(uid);
+    return iter != s_uid_running_count.end() ? iter->second : 0;
+}
+
+int32_t WorkStatus::GetBundleRunningCount(const std::string &bundleName)
+{
+    std::lock_guard<ffrt::mutex> lock(s_running_count_mutex);
+    auto iter = s_bundle_running_count.find(bundleName);
+    return iter != s_bundle_running_count.end() ? iter->second : 0;
 }
 
 void WorkStatus::MarkRound() {}
@@ -247,7 +366,7 @@ bool WorkStatus::NeedRemove()
 
 bool WorkStatus::IsSameUser()
 {
-    if (userId_ > 0 && !WorkSchedUtils::IsIdActive(userId_)) {
+    if (userId_ > 0 && !DelayedSingleton<DataManager>::GetInstance()->IsUserActive(userId_)) {
         return false;
     }
     return true;
@@ -263,9 +382,7 @@ bool WorkStatus::IsUriKeySwitchOn()
         return false;
     }
     string key = workInfo_->GetUriKey();
-    string value;
-    (void)WorkDatashareHelper::GetInstance().GetStringValue(key, value);
-    if (value == SWITCH_ON) {
+    if (WorkDatashareHelper::GetInstance().IsSwitchOn(key)) {
         return true;
     }
     WS_HILOGE("workid %{public}s key %{public}s, value is 0", workId_.c_str(), key.c_str());
@@ -274,25 +391,25 @@ bool WorkStatus::IsUriKeySwitchOn()
 
 bool WorkStatus::IsReady()
 {
-    conditionStatus_.clear();
+    conditionStatus_.Clear();
     if (!IsSameUser()) {
-        conditionStatus_ += DELIMITER + "notSameUser";
+        conditionStatus_.SetFlag(ConditionStatus::NOT_SAME_USER);
         return false;
     }
     if (IsRunning()) {
         HasTimeout();
-        conditionStatus_ += DELIMITER + "running";
+        conditionStatus_.SetFlag(ConditionStatus::RUNNING);
         return false;
     }
     if (!IsConditionReady()) {
         return false;
     }
     if (!IsUriKeySwitchOn()) {
-        conditionStatus_ += DELIMITER + "uriKeyOFF";
+        conditionStatus_.SetFlag(ConditionStatus::URI_KEY_OFF);
         return false;
     }
     if (DelayedSingleton<WorkSchedulerService>::GetInstance()->CheckEffiResApplyInfo(uid_)) {
-        conditionStatus_ += DELIMITER + "effiResWhitelist";
+        conditionStatus_.SetFlag(ConditionStatus::EFFI_RES_WHITELIST);
         return true;
     }
     if (!g_groupDebugMode && ((!groupChanged_ && !SetMinInterval()) || minInterval_ == -1)) {
@@ -307,13 +424,12 @@ bool WorkStatus::IsReady()
             WS_HILOGE("The initial startup time does not meet the EarliestStartTime requirement.");
             return false;
         }
-        conditionStatus_ += DELIMITER + "firstTrigger";
+        conditionStatus_.SetFlag(ConditionStatus::FIRST_TRIGGER);
         return true;
     }
     double del = difftime(getOppositeTime(), s_uid_last_time_map[uid_]);
     if (del < minInterval_) {
-        conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[WorkCondition::Type::GROUP] + "&" + NOT_OK + "(" +
-            to_string(static_cast<long>(del)) + ":" + to_string(minInterval_) + ")";
+        conditionStatus_.SetNotOk(WorkCondition::Type::GROUP, static_cast<int64_t>(del), minInterval_);
         needRetrigger_ = true;
         timeRetrigger_ = int(minInterval_ - del + ONE_SECOND);
         return false;
@@ -326,7 +442,7 @@ bool WorkStatus::IsReady()
 
 bool WorkStatus::IsSAReady()
 {
-    conditionStatus_.clear();
+    conditionStatus_.Clear();
     if (!IsStandbyExemption()) {
         return false;
     }
@@ -339,54 +455,81 @@ bool WorkStatus::IsSAReady()
 
 bool WorkStatus::IsConditionReady()
 {
-    auto workConditionMap = workInfo_->GetConditionMap();
     std::lock_guard<ffrt::mutex> lock(conditionMapMutex_);
+    uint32_t requiredMask = workInfo_->GetConditionMask();
+    RefreshSatisfiedMask(requiredMask);
     bool isReady = true;
-    for (auto it : *workConditionMap) {
-        if (conditionMap_.count(it.first) <= 0) {
-            conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[it.first] + "&" + NOT_OK;
+    for (uint32_t mask = requiredMask; mask != 0; mask &= mask - 1) {
+        auto type = static_cast<WorkCondition::Type>(__builtin_ctz(mask));
+        if ((satisfiedMask_ & ConditionSlots::TypeBit(type)) == 0) {
+            conditionStatus_.SetResult(type, false);
             isReady = false;
             break;
         }
-        if (!IsBatteryAndNetworkReady(it.first) || !IsStorageReady(it.first) ||
-            !IsChargerReady(it.first) || !IsNapReady(it.first)) {
-            conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[it.first] + "&" + NOT_OK;
+        if (!IsTimerReady(type)) {
             isReady = false;
             break;
         }
-        if (!IsTimerReady(it.first)) {
-            isReady = false;
-            break;
-        }
-        conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[it.first] + "&" + OK;
+        conditionStatus_.SetResult(type, true);
     }
     return isReady;
 }
 
+void WorkStatus::RefreshSatisfiedMask(uint32_t requiredMask)
+{
+    uint32_t changedMask = conditionMap_.TakeChangedMask();
+    snapshot_ = SystemStateSnapshot::GetCurrent();
+    uint64_t snapshotVersion = snapshot_ ? snapshot_->GetVersion() : 0;
+    if (snapshotVersion < snapshotVersion_) {
+        changedMask = requiredMask;
+    } else if (snapshot_) {
+        changedMask |= snapshot_->GetChangedMask(snapshotVersion_);
+    }
+    snapshotVersion_ = snapshotVersion;
+    bool sameWorkInfo = !satisfiedWorkInfo_.owner_before(workInfo_) && !workInfo_.owner_before(satisfiedWorkInfo_);
+    if (!sameWorkInfo || satisfiedRequiredMask_ != requiredMask) {
+        satisfiedWorkInfo_ = workInfo_;
+        satisfiedRequiredMask_ = requiredMask;
+        satisfiedMask_ = 0;
+        changedMask = requiredMask;
+    }
+    for (uint32_t mask = changedMask & requiredMask; mask != 0; mask &= mask - 1) {
+        auto type = static_cast<WorkCondition::Type>(__builtin_ctz(mask));
+        bool satisfied = GetConditionValue(type, snapshot_) != nullptr && workInfo_->GetCondition(type) != nullptr &&
+            IsBatteryAndNetworkReady(type) && IsStorageReady(type) && IsChargerReady(type) && IsNapReady(type);
+        if (satisfied) {
+            satisfiedMask_ |= ConditionSlots::TypeBit(type);
+        } else {
+            satisfiedMask_ &= ~ConditionSlots::TypeBit(type);
+        }
+    }
+}
+
 bool WorkStatus::IsBatteryAndNetworkReady(WorkCondition::Type type)
 {
-    auto workConditionMap = workInfo_->GetConditionMap();
+    const auto &conditionSet = workInfo_->GetCondition(type);
+    const auto &conditionCurrent = GetConditionValue(type, snapshot_);
     switch (type) {
         case WorkCondition::Type::NETWORK: {
-            if (conditionMap_.at(type)->enumVal == WorkCondition::Network::NETWORK_UNKNOWN) {
+            if (conditionCurrent->enumVal == WorkCondition::Network::NETWORK_UNKNOWN) {
                 return false;
             }
-            if (workConditionMap->at(type)->enumVal != WorkCondition::Network::NETWORK_TYPE_ANY &&
-                workConditionMap->at(type)->enumVal != conditionMap_.at(type)->enumVal) {
+            if (conditionSet->enumVal != WorkCondition::Network::NETWORK_TYPE_ANY &&
+                conditionSet->enumVal != conditionCurrent->enumVal) {
                 return false;
             }
             break;
         }
         case WorkCondition::Type::BATTERY_STATUS: {
-            int32_t batteryReq = workConditionMap->at(type)->enumVal;
+            int32_t batteryReq = conditionSet->enumVal;
             if (batteryReq != WorkCondition::BatteryStatus::BATTERY_STATUS_LOW_OR_OKAY &&
-                batteryReq != conditionMap_.at(type)->enumVal) {
+                batteryReq != conditionCurrent->enumVal) {
                 return false;
             }
             break;
         }
         case WorkCondition::Type::BATTERY_LEVEL: {
-            if (workConditionMap->at(type)->intVal > conditionMap_.at(type)->intVal) {
+            if (conditionSet->intVal > conditionCurrent->intVal) {
                 return false;
             }
             break;
@@ -402,8 +545,8 @@ bool WorkStatus::IsChargerReady(WorkCondition::Type type)
     if (type != WorkCondition::Type::CHARGER) {
         return true;
     }
-    auto conditionSet = workInfo_->GetConditionMap()->at(WorkCondition::Type::CHARGER);
-    auto conditionCurrent = conditionMap_.at(WorkCondition::Type::CHARGER);
+    const auto &conditionSet = workInfo_->GetCondition(WorkCondition::Type::CHARGER);
+    const auto &conditionCurrent = GetConditionValue(WorkCondition::Type::CHARGER, snapshot_);
     if (conditionSet->boolVal != conditionCurrent->boolVal) {
         return false;
     }
@@ -425,9 +568,10 @@ bool WorkStatus::IsStorageReady(WorkCondition::Type type)
     if (type != WorkCondition::Type::STORAGE) {
         return true;
     }
-    auto workConditionMap = workInfo_->GetConditionMap();
-    if (workConditionMap->at(type)->enumVal != WorkCondition::Storage::STORAGE_LEVEL_LOW_OR_OKAY &&
-        workConditionMap->at(type)->enumVal != conditionMap_.at(type)->enumVal) {
+    const auto &conditionSet = workInfo_->GetCondition(type);
+    const auto &conditionCurrent = GetConditionValue(type, snapshot_);
+    if (conditionSet->enumVal != WorkCondition::Storage::STORAGE_LEVEL_LOW_OR_OKAY &&
+        conditionSet->enumVal != conditionCurrent->enumVal) {
         return false;
     }
     return true;
@@ -454,8 +598,7 @@ bool WorkStatus::IsTimerReady(WorkCondition::Type type)
     if (type != WorkCondition::Type::TIMER) {
         return true;
     }
-    auto workConditionMap = workInfo_->GetConditionMap();
-    uint32_t intervalTime = workConditionMap->at(WorkCondition::Type::TIMER)->uintVal;
+    uint32_t intervalTime = workInfo_->GetCondition(WorkCondition::Type::TIMER)->uintVal;
     time_t lastTime;
     if (s_uid_last_time_map.find(uid_) == s_uid_last_time_map.end()) {
         lastTime = 0;
@@ -466,8 +609,7 @@ bool WorkStatus::IsTimerReady(WorkCondition::Type type)
     double oppositedel = difftime(getOppositeTime(), lastTime);
     double del = currentdel > oppositedel ? currentdel : oppositedel;
     if (del < intervalTime) {
-        conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[type] + "&" + NOT_OK + "(" +
-            to_string(static_cast<long>(del)) + ":" + to_string(intervalTime) + ")";
+        conditionStatus_.SetNotOk(type, static_cast<int64_t>(del), static_cast<int64_t>(intervalTime));
         return false;
     }
     return true;
@@ -491,8 +633,8 @@ bool WorkStatus::IsNapReady(WorkCondition::Type type)
     if (type != WorkCondition::Type::DEEP_IDLE) {
         return true;
     }
-    auto conditionSet = workInfo_->GetConditionMap()->at(WorkCondition::Type::DEEP_IDLE);
-    auto conditionCurrent = conditionMap_.at(WorkCondition::Type::DEEP_IDLE);
+    const auto &conditionSet = workInfo_->GetCondition(WorkCondition::Type::DEEP_IDLE);
+    const auto &conditionCurrent = GetConditionValue(WorkCondition::Type::DEEP_IDLE, snapshot_);
     if (conditionSet->boolVal != conditionCurrent->boolVal) {
         return false;
     }
@@ -502,6 +644,10 @@ bool WorkStatus::IsNapReady(WorkCondition::Type type)
 bool WorkStatus::IsChargingState()
 {
 #ifdef POWERMGR_BATTERY_MANAGER_ENABLE
+    int32_t chargerType = DelayedSingleton<DataManager>::GetInstance()->GetChargerType();
+    if (chargerType != WorkCondition::Charger::CHARGING_UNKNOWN) {
+        return chargerType != WorkCondition::Charger::CHARGING_UNPLUGGED;
+    }
     auto type = PowerMgr::BatterySrvClient::GetInstance().GetPluggedType();
     return type != PowerMgr::BatteryPluggedType::PLUGGED_TYPE_NONE &&
         type != PowerMgr::BatteryPluggedType::PLUGGED_TYPE_BUTT;
@@ -513,6 +659,10 @@ bool WorkStatus::IsChargingState()
 #ifdef DEVICE_USAGE_STATISTICS_ENABLE
 bool WorkStatus::IsMailApp()
 {
+    bool isMailApp = false;
+    if (DelayedSingleton<DataManager>::GetInstance()->FindMailApp(bundleName_, isMailApp)) {
+        return isMailApp;
+    }
     nlohmann::json payload;
     nlohmann::json reply;
     payload["bundleName"] = bundleName_;
@@ -540,10 +690,12 @@ bool WorkStatus::IsMailApp()
 
     for (const auto& type : pkgTypes) {
         if (type == GroupConst::APP_TYPE_EMAIL) {
-            return true;
+            isMailApp = true;
+            break;
         }
     }
-    return false;
+    DelayedSingleton<DataManager>::GetInstance()->AddMailApp(bundleName_, isMailApp);
+    return isMailApp;
 }
 #endif
 
@@ -736,7 +888,7 @@ void WorkStatus::Dump(string& result)
     } else {
         result.append(string("\"bundleName\":") + bundleName_ + ",\n");
     }
-    result.append(string("\"status\":") + to_string(currentStatus_) + ",\n");
+    result.append(string("\"status\":") + to_string(currentStatus_.load()) + ",\n");
     result.append(string("\"paused\":") + (paused_ ? "true" : "false") + ",\n");
     result.append(string("\"priority\":") + to_string(priority_) + ",\n");
     result.append(string("\"conditionMap\":{\n"));
@@ -750,27 +902,27 @@ void WorkStatus::Dump(string& result)
 void WorkStatus::DumpCondition(string& result)
 {
     std::lock_guard<ffrt::mutex> lock(conditionMapMutex_);
-    if (conditionMap_.count(WorkCondition::Type::NETWORK) > 0) {
-        result.append(string("\"networkType\":") +
-            to_string(conditionMap_.at(WorkCondition::Type::NETWORK)->enumVal) + ",\n");
+    auto snapshot = SystemStateSnapshot::GetCurrent();
+    const auto &network = GetConditionValue(WorkCondition::Type::NETWORK, snapshot);
+    if (network != nullptr) {
+        result.append(string("\"networkType\":") + to_string(network->enumVal) + ",\n");
     }
-    if (conditionMap_.count(WorkCondition::Type::CHARGER) > 0) {
-        result.append(string("\"isCharging\":") +
-            (conditionMap_.at(WorkCondition::Type::CHARGER)->boolVal ? "true" : "false") + ",\n");
-        result.append(string("\"chargerType\":") +
-            to_string(conditionMap_.at(WorkCondition::Type::CHARGER)->enumVal) + ",\n");
+    const auto &charger = GetConditionValue(WorkCondition::Type::CHARGER, snapshot);
+    if (charger != nullptr) {
+        result.append(string("\"isCharging\":") + (charger->boolVal ? "true" : "false") + ",\n");
+        result.append(string("\"chargerType\":") + to_string(charger->enumVal) + ",\n");
     }
-    if (conditionMap_.count(WorkCondition::Type::BATTERY_LEVEL) > 0) {
-        result.append(string("\"batteryLevel\":") +
-            to_string(conditionMap_.at(WorkCondition::Type::BATTERY_LEVEL)->intVal) + ",\n");
+    const auto &batteryLevel = GetConditionValue(WorkCondition::Type::BATTERY_LEVEL, snapshot);
+    if (batteryLevel != nullptr) {
+        result.append(string("\"batteryLevel\":") + to_string(batteryLevel->intVal) + ",\n");
     }
-    if (conditionMap_.count(WorkCondition::Type::BATTERY_STATUS) > 0) {
-        result.append(string("\"batteryStatus\":") +
-            to_string(conditionMap_.at(WorkCondition::Type::BATTERY_STATUS)->enumVal) + ",\n");
+    const auto &batteryStatus = GetConditionValue(WorkCondition::Type::BATTERY_STATUS, snapshot);
+    if (batteryStatus != nullptr) {
+        result.append(string("\"batteryStatus\":") + to_string(batteryStatus->enumVal) + ",\n");
     }
-    if (conditionMap_.count(WorkCondition::Type::STORAGE) > 0) {
-        result.append(string("\"storageLevel\":") +
-            to_string(conditionMap_.at(WorkCondition::Type::STORAGE)->enumVal) + ",\n");
+    const auto &storage = GetConditionValue(WorkCondition::Type::STORAGE, snapshot);
+    if (storage != nullptr) {
+        result.append(string("\"storageLevel\":") + to_string(storage->enumVal) + ",\n");
     }
     if (conditionMap_.count(WorkCondition::Type::TIMER) > 0) {
         result.append(string("\"baseTime\":") + to_string(baseTime_) + ",\n");
@@ -781,9 +933,9 @@ void WorkStatus::DumpCondition(string& result)
                 to_string(conditionMap_.at(WorkCondition::Type::TIMER)->intVal) + ",\n");
         }
     }
-    if (conditionMap_.count(WorkCondition::Type::DEEP_IDLE) > 0) {
-        result.append(string("\"isDeepIdle\":") +
-            to_string(conditionMap_.at(WorkCondition::Type::DEEP_IDLE)->boolVal) + ",\n");
+    const auto &deepIdle = GetConditionValue(WorkCondition::Type::DEEP_IDLE, snapshot);
+    if (deepIdle != nullptr) {
+        result.append(string("\"isDeepIdle\":") + to_string(deepIdle->boolVal) + ",\n");
     }
 }
 
@@ -791,25 +943,80 @@ void WorkStatus::ToString(WorkCondition::Type type)
 {
     auto dataManager = DelayedSingleton<DataManager>::GetInstance();
     if (dataManager->GetDeviceSleep()) {
-        if (dataManager->IsInDeviceStandyWhitelist(bundleName_)) {
-            conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[WorkCondition::Type::STANDBY] + "&" + OK;
-        } else {
-            conditionStatus_ += DELIMITER + COND_TYPE_STRING_MAP[WorkCondition::Type::STANDBY] + "&" + NOT_OK;
-        }
+        conditionStatus_.SetResult(WorkCondition::Type::STANDBY,
+            dataManager->IsInDeviceStandyWhitelist(bundleName_));
     }
-    if (type != WorkCondition::Type::GROUP && conditionStatus_.empty()) {
+    if (type != WorkCondition::Type::GROUP && conditionStatus_.IsEmpty()) {
         WS_HILOGE("%{public}s, condition is empty", COND_TYPE_STRING_MAP[type].c_str());
         return;
     }
+    std::string conditionStatus = conditionStatus_.Format();
     if (workInfo_->IsSA()) {
         WS_HILOGI("%{public}s,%{public}s%{public}s", COND_TYPE_STRING_MAP[type].c_str(),
-            workId_.c_str(), conditionStatus_.c_str());
+            workId_.c_str(), conditionStatus.c_str());
     } else {
         WS_HILOGI("%{public}s,%{public}s_%{public}s%{public}s", COND_TYPE_STRING_MAP[type].c_str(),
-            bundleName_.c_str(), workId_.c_str(), conditionStatus_.c_str());
+            bundleName_.c_str(), workId_.c_str(), conditionStatus.c_str());
     }
 }
 
+void WorkStatus::ConditionStatus::SetNotOk(WorkCondition::Type type, int64_t elapsed, int64_t required)
+{
+    SetResult(type, false);
+    if (type == WorkCondition::Type::TIMER) {
+        timerElapsed = elapsed;
+        timerRequired = required;
+    } else if (type == WorkCondition::Type::GROUP) {
+        groupElapsed = elapsed;
+        groupRequired = required;
+    } else {
+        return;
+    }
+    detailMask |= ConditionSlots::TypeBit(type);
+}
+
+std::string WorkStatus::ConditionStatus::Format() const
+{
+    std::string result;
+    auto appendResult = [this, &result](WorkCondition::Type type) {
+        uint32_t bit = ConditionSlots::TypeBit(type);
+        if ((okMask & bit) != 0) {
+            result += DELIMITER + COND_TYPE_STRING_MAP[type] + "&" + OK;
+        } else if ((notOkMask & bit) != 0) {
+            result += DELIMITER + COND_TYPE_STRING_MAP[type] + "&" + NOT_OK;
+            if ((detailMask & bit) != 0) {
+                bool isTimer = type == WorkCondition::Type::TIMER;
+                result += "(" + to_string(isTimer ? timerElapsed : groupElapsed) + ":" +
+                    to_string(isTimer ? timerRequired : groupRequired) + ")";
+            }
+        }
+    };
+    // Same order as IsReady judges them: user and status, conditions, uri key and group, standby last.
+    if ((flags & NOT_SAME_USER) != 0) {
+        result += DELIMITER + "notSameUser";
+    }
+    if ((flags & RUNNING) != 0) {
+        result += DELIMITER + "running";
+    }
+    for (uint32_t type = 0; type < ConditionSlots::SLOT_COUNT; type++) {
+        if (type != WorkCondition::Type::GROUP && type != WorkCondition::Type::STANDBY) {
+            appendResult(static_cast<WorkCondition::Type>(type));
+        }
+    }
+    if ((flags & URI_KEY_OFF) != 0) {
+        result += DELIMITER + "uriKeyOFF";
+    }
+    if ((flags & EFFI_RES_WHITELIST) != 0) {
+        result += DELIMITER + "effiResWhitelist";
+    }
+    if ((flags & FIRST_TRIGGER) != 0) {
+        result += DELIMITER + "firstTrigger";
+    }
+    appendResult(WorkCondition::Type::GROUP);
+    appendResult(WorkCondition::Type::STANDBY);
+    return result;
+}
+
 bool WorkStatus::HasTimeout()
 {
     if (!IsRunning() || IsPaused()) {
@@ -820,7 +1027,7 @@ bool WorkStatus::HasTimeout()
         WS_HILOGE("invalid watchdogtime, bundleName:%{public}s, workId:%{public}s, watchdogtime:%{public}" PRIu64
             " workStartTime:%{public}" PRIu64, bundleName_.c_str(), workId_.c_str(), workWatchDogTime_, workStartTime_);
         workWatchDogTime_ = 0;
-        timeout_.store(true);
+        SetTimeout(true);
         return true;
     }
 
@@ -830,7 +1037,7 @@ bool WorkStatus::HasTimeout()
             " workStartTime:%{public}" PRIu64 " runningTime:%{public}" PRIu64, bundleName_.c_str(), workId_.c_str(),
             workWatchDogTime_, workStartTime_, runningTime);
         workWatchDogTime_ = 0;
-        timeout_.store(true);
+        SetTimeout(true);
         return true;
     }
     return false;
@@ -839,6 +1046,33 @@ bool WorkStatus::HasTimeout()
 void WorkStatus::SetTimeout(bool timeout)
 {
     timeout_.store(timeout);
+    if (timeout) {
+        std::lock_guard<ffrt::mutex> lock(s_timeout_works_mutex);
+        s_timeout_works.insert(workKey_);
+    }
+}
+
+std::unordered_set<WorkKey, WorkKeyHash> WorkStatus::TakeTimeoutWorks()
+{
+    std::unordered_set<WorkKey, WorkKeyHash> timeoutWorks;
+    std::lock_guard<ffrt::mutex> lock(s_timeout_works_mutex);
+    timeoutWorks.swap(s_timeout_works);
+    return timeoutWorks;
+}
+
+void WorkStatus::ArmTimeoutDeadline()
+{
+    // an invalid watchdog time is reported by HasTimeout at once.
+    uint64_t deadline = workWatchDogTime_ > LONG_WATCHDOG_TIME ? 0 :
+        workStartTime_ + workWatchDogTime_ + WATCHDOG_TIMEOUT_THRESHOLD_MS;
+    uint64_t current = s_timeout_deadline.load();
+    while (deadline < current && !s_timeout_deadline.compare_exchange_weak(current, deadline)) {}
+}
+
+bool WorkStatus::TakeDueTimeoutDeadline(uint64_t now)
+{
+    uint64_t deadline = s_timeout_deadline.load();
+    return now > deadline && s_timeout_deadline.compare_exchange_strong(deadline, UINT64_MAX);
 }
 
 bool WorkStatus::IsTimeout()
@@ -894,10 +1128,10 @@ bool WorkStatus::IsNeedDiscreteScheduled()
     if (!workInfo_->IsCallBySystemApp()) {
         return false;
     }
-    auto workConditionMap = workInfo_->GetConditionMap();
     auto type = WorkCondition::Type::NETWORK;
     std::lock_guard<ffrt::mutex> lock(conditionMapMutex_);
-    if (conditionMap_.count(type) <= 0 || workConditionMap->count(type) <= 0) {
+    if (GetConditionValue(type, snapshot_) == nullptr ||
+        (workInfo_->GetConditionMask() & ConditionSlots::TypeBit(type)) == 0) {
         return false;
     }
     if (!IsBatteryAndNetworkReady(type)) {
@@ -86,5 +86,34 @@ HWTEST_F(MemoryPolicyTest, GetPolicyMaxRunning_003, TestSize.Level1)
     int32_t ret = memoryPolicy_->GetPolicyMaxRunning(systemPolicy);
     EXPECT_EQ(ret, 3);
 }
+
+/**
+ * @tc.name: ParseMemAvailable_001
+ * @tc.desc: Test MemInfoReader ParseMemAvailable.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(MemoryPolicyTest, ParseMemAvailable_001, TestSize.Level1)
+{
+    const char memInfo[] = "MemTotal:        7869932 kB\nMemFree:          285156 kB\n"
+        "MemAvailable:    2958216 kB\nBuffers:            2328 kB\n";
+    EXPECT_EQ(MemInfoReader::ParseMemAvailable(memInfo), 2958216);
+    EXPECT_EQ(MemInfoReader::ParseMemAvailable("MemTotal:        7869932 kB\n"), -1);
+    EXPECT_EQ(MemInfoReader::ParseMemAvailable("MemAvailable:      kB\n"), -1);
+}
+
+/**
+ * @tc.name: ParseSomeAvg10_001
+ * @tc.desc: Test MemInfoReader ParseSomeAvg10.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(MemoryPolicyTest, ParseSomeAvg10_001, TestSize.Level1)
+{
+    EXPECT_EQ(MemInfoReader::ParseSomeAvg10("some avg10=12.34 avg60=1.00 avg300=0.00 total=100\n"), 1234);
+    EXPECT_EQ(MemInfoReader::ParseSomeAvg10("some avg10=0.00 avg60=0.00 avg300=0.00 total=0\n"), 0);
+    EXPECT_EQ(MemInfoReader::ParseSomeAvg10("some avg10=100.00 avg60=0.00 avg300=0.00 total=0\n"), 10000);
+    EXPECT_EQ(MemInfoReader::ParseSomeAvg10("full avg10=1.00 avg60=0.00 avg300=0.00 total=0\n"), -1);
+}
 }
 }
@@ -96,5 +96,41 @@ HWTEST_F(PowerModePolicyTest, GetPolicyMaxRunning_003, TestSize.Level1)
     int32_t ret = powerModePolicy_->GetPolicyMaxRunning(systemPolicy);
     EXPECT_EQ(ret, 3);
 }
+
+/**
+ * @tc.name: OnPowerModeChanged_001
+ * @tc.desc: Test PowerModePolicy OnPowerModeChanged.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(PowerModePolicyTest, OnPowerModeChanged_001, TestSize.Level1)
+{
+    WorkSchedSystemPolicy systemPolicy;
+    PowerMgr::PowerMgrClient::GetInstance().SetDeviceMode(PowerMgr::PowerMode::POWER_SAVE_MODE);
+    powerModePolicy_->OnPowerModeChanged(PowerMgr::PowerMode::PERFORMANCE_MODE);
+    EXPECT_EQ(powerModePolicy_->GetSampleTtlMs(), 0);
+    int32_t ret = powerModePolicy_->GetPolicyMaxRunning(systemPolicy);
+    EXPECT_EQ(ret, 3);
+    EXPECT_EQ(systemPolicy.powerMode, static_cast<uint32_t>(PowerMgr::PowerMode::PERFORMANCE_MODE));
+    powerModePolicy_->powerMode_.store(0);
+}
+
+/**
+ * @tc.name: OnServiceRemoved_001
+ * @tc.desc: Test PowerModePolicy falls back to polling once the power manager is removed.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(PowerModePolicyTest, OnServiceRemoved_001, TestSize.Level1)
+{
+    powerModePolicy_->powerModeCallback_ = new PowerModePolicy::PowerModeCallback(powerModePolicy_);
+    powerModePolicy_->OnPowerModeChanged(PowerMgr::PowerMode::PERFORMANCE_MODE);
+    EXPECT_EQ(powerModePolicy_->GetSampleTtlMs(), 0);
+
+    powerModePolicy_->OnServiceRemoved();
+    EXPECT_EQ(powerModePolicy_->powerModeCallback_, nullptr);
+    EXPECT_EQ(powerModePolicy_->powerMode_.load(), 0);
+    EXPECT_GT(powerModePolicy_->GetSampleTtlMs(), 0);
+}
 }
 }
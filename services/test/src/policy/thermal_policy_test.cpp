@@ -192,5 +192,45 @@ HWTEST_F(ThermalPolicyTest, GetPolicyMaxRunning_008, TestSize.Level1)
     int32_t ret = thermalPolicy_->GetPolicyMaxRunning(systemPolicy);
     EXPECT_EQ(ret, COUNT_THERMAL_NORMAL);
 }
+
+/**
+ * @tc.name: OnThermalLevelChanged_001
+ * @tc.desc: Test ThermalPolicy OnThermalLevelChanged.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(ThermalPolicyTest, OnThermalLevelChanged_001, TestSize.Level1)
+{
+    WorkSchedSystemPolicy systemPolicy;
+    MockProcess(PowerMgr::ThermalLevel::WARNING);
+    workPolicyManager_->SetThermalLevelByDump(-1);
+    thermalPolicy_->OnThermalLevelChanged(static_cast<int32_t>(PowerMgr::ThermalLevel::COOL));
+    EXPECT_EQ(thermalPolicy_->GetSampleTtlMs(), 0);
+    int32_t ret = thermalPolicy_->GetPolicyMaxRunning(systemPolicy);
+    EXPECT_EQ(ret, COUNT_THERMAL_NORMAL);
+
+    thermalPolicy_->OnThermalLevelChanged(static_cast<int32_t>(PowerMgr::ThermalLevel::EMERGENCY));
+    ret = thermalPolicy_->GetPolicyMaxRunning(systemPolicy);
+    EXPECT_EQ(ret, COUNT_THERMAL_CRUCIAL);
+    thermalPolicy_->thermalLevel_.store(-1);
+}
+
+/**
+ * @tc.name: OnServiceRemoved_001
+ * @tc.desc: Test ThermalPolicy falls back to polling once the thermal manager is removed.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(ThermalPolicyTest, OnServiceRemoved_001, TestSize.Level1)
+{
+    thermalPolicy_->thermalLevelCallback_ = new ThermalPolicy::ThermalLevelCallback(thermalPolicy_);
+    thermalPolicy_->OnThermalLevelChanged(static_cast<int32_t>(PowerMgr::ThermalLevel::COOL));
+    EXPECT_EQ(thermalPolicy_->GetSampleTtlMs(), 0);
+
+    thermalPolicy_->OnServiceRemoved();
+    EXPECT_EQ(thermalPolicy_->thermalLevelCallback_, nullptr);
+    EXPECT_EQ(thermalPolicy_->thermalLevel_.load(), -1);
+    EXPECT_GT(thermalPolicy_->GetSampleTtlMs(), 0);
+}
 }
 }
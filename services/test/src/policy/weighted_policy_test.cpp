@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "policy/weighted_policy.h"
+#include "work_queue.h"
+#include "work_status.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace WorkScheduler {
+namespace {
+const std::string HEAVY_BUNDLE = "com.example.heavy";
+const std::string LIGHT_BUNDLE = "com.example.light";
+
+nlohmann::json CreateConfig()
+{
+    return nlohmann::json::parse(R"({
+        "enable": true,
+        "max_running_count": 6,
+        "light_duration_ms": 1000,
+        "light_cost": 50,
+        "heavy_duration_ms": 60000,
+        "heavy_cost": 300,
+        "bundle_costs": [ { "bundleName": "com.example.heavy", "cost": 250 } ]
+    })");
+}
+}
+
+class WeightedPolicyTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: GetWorkCost_001
+ * @tc.desc: Test WeightedPolicy GetWorkCost.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WeightedPolicyTest, GetWorkCost_001, TestSize.Level1)
+{
+    auto execHistory = std::make_shared<WorkExecHistory>();
+    WeightedPolicy weightedPolicy(execHistory);
+    WorkInfo workInfo;
+    workInfo.SetElement(LIGHT_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetWorkId(2);
+    auto newWork = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetElement(HEAVY_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(3);
+    auto heavyWork = std::make_shared<WorkStatus>(workInfo, 1);
+    execHistory->OnWorkStop(work, 500, false);
+    EXPECT_FALSE(weightedPolicy.IsEnabled());
+    EXPECT_EQ(weightedPolicy.GetWorkCost(work), WORK_COST_UNIT);
+
+    EXPECT_TRUE(weightedPolicy.UpdateConfig(CreateConfig()));
+    EXPECT_TRUE(weightedPolicy.IsEnabled());
+    EXPECT_EQ(weightedPolicy.GetWorkCost(work), 50);
+    EXPECT_EQ(weightedPolicy.GetWorkCost(newWork), WORK_COST_UNIT);
+    execHistory->OnWorkStop(work, 20000, false);
+    EXPECT_EQ(weightedPolicy.GetWorkCost(work), WORK_COST_UNIT);
+    for (int32_t i = 0; i < 10; i++) {
+        execHistory->OnWorkStop(work, 80000, false);
+    }
+    EXPECT_EQ(weightedPolicy.GetWorkCost(work), 300);
+    EXPECT_EQ(weightedPolicy.GetWorkCost(heavyWork), 250);
+    EXPECT_FALSE(weightedPolicy.UpdateConfig(nlohmann::json::array()));
+}
+
+/**
+ * @tc.name: GetWorkCost_002
+ * @tc.desc: Test WeightedPolicy GetWorkCost keeps the cost of a repeating work after its run is reset.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WeightedPolicyTest, GetWorkCost_002, TestSize.Level1)
+{
+    auto execHistory = std::make_shared<WorkExecHistory>();
+    WeightedPolicy weightedPolicy(execHistory);
+    EXPECT_TRUE(weightedPolicy.UpdateConfig(CreateConfig()));
+    WorkInfo workInfo;
+    workInfo.SetElement(LIGHT_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work = std::make_shared<WorkStatus>(workInfo, 1);
+    work->duration_ = 500;
+    EXPECT_EQ(weightedPolicy.GetWorkCost(work), WORK_COST_UNIT);
+    execHistory->OnWorkStop(work, work->duration_, false);
+    // what StopWork does to a repeating work.
+    work->duration_ = 0;
+    EXPECT_EQ(weightedPolicy.GetWorkCost(work), 50);
+}
+
+/**
+ * @tc.name: CanRun_001
+ * @tc.desc: Test WeightedPolicy CanRun with the count admission.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WeightedPolicyTest, CanRun_001, TestSize.Level1)
+{
+    WeightedPolicy weightedPolicy;
+    WorkInfo workInfo;
+    workInfo.SetElement(LIGHT_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work = std::make_shared<WorkStatus>(workInfo, 1);
+    EXPECT_TRUE(weightedPolicy.CanRun(work, MAX_RUNNING_COUNT, MAX_RUNNING_COUNT - 1));
+    EXPECT_FALSE(weightedPolicy.CanRun(work, MAX_RUNNING_COUNT, MAX_RUNNING_COUNT));
+}
+
+/**
+ * @tc.name: CanRun_002
+ * @tc.desc: Test WeightedPolicy CanRun runs cheap works together and throttles heavy works.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WeightedPolicyTest, CanRun_002, TestSize.Level1)
+{
+    auto execHistory = std::make_shared<WorkExecHistory>();
+    WeightedPolicy weightedPolicy(execHistory);
+    EXPECT_TRUE(weightedPolicy.UpdateConfig(CreateConfig()));
+    int32_t runningCost = WorkStatus::GetRunningCost();
+    int32_t runningCount = WorkStatus::GetRunningCount();
+    WorkInfo workInfo;
+    workInfo.SetElement(HEAVY_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto heavyWork = std::make_shared<WorkStatus>(workInfo, 1);
+    EXPECT_TRUE(weightedPolicy.CanRun(heavyWork, MAX_RUNNING_COUNT, 0));
+    EXPECT_FALSE(weightedPolicy.CanRun(heavyWork, 0, 0));
+
+    workInfo.SetElement(LIGHT_BUNDLE, "workStatusAbility");
+    std::vector<std::shared_ptr<WorkStatus>> lightWorks;
+    for (int32_t i = 0; i < MAX_RUNNING_COUNT + 1; i++) {
+        workInfo.SetWorkId(i + 2);
+        auto work = std::make_shared<WorkStatus>(workInfo, 1);
+        execHistory->OnWorkStop(work, 500, false);
+        work->SetRunningCost(weightedPolicy.GetWorkCost(work));
+        work->MarkStatus(WorkStatus::Status::RUNNING);
+        lightWorks.emplace_back(work);
+    }
+    EXPECT_EQ(WorkStatus::GetRunningCost(), runningCost + (MAX_RUNNING_COUNT + 1) * 50);
+    workInfo.SetWorkId(MAX_RUNNING_COUNT + 3);
+    auto lightWork = std::make_shared<WorkStatus>(workInfo, 1);
+    execHistory->OnWorkStop(lightWork, 500, false);
+    if (runningCost == 0) {
+        EXPECT_TRUE(weightedPolicy.CanRun(lightWork, MAX_RUNNING_COUNT, runningCount + MAX_RUNNING_COUNT + 1));
+    }
+    EXPECT_FALSE(weightedPolicy.CanRun(heavyWork, MAX_RUNNING_COUNT, runningCount + MAX_RUNNING_COUNT + 1));
+    EXPECT_FALSE(weightedPolicy.CanRun(lightWork, MAX_RUNNING_COUNT, 6));
+    lightWorks.clear();
+    EXPECT_EQ(WorkStatus::GetRunningCost(), runningCost);
+}
+
+/**
+ * @tc.name: CanRun_003
+ * @tc.desc: Test WeightedPolicy CanRun lets a cheap work start while the heavy top work is over the budget.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WeightedPolicyTest, CanRun_003, TestSize.Level1)
+{
+    auto execHistory = std::make_shared<WorkExecHistory>();
+    WeightedPolicy weightedPolicy(execHistory);
+    EXPECT_TRUE(weightedPolicy.UpdateConfig(CreateConfig()));
+    WorkInfo workInfo;
+    workInfo.SetElement(HEAVY_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto heavyWork = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetElement(LIGHT_BUNDLE, "workStatusAbility");
+    workInfo.SetWorkId(2);
+    auto lightWork = std::make_shared<WorkStatus>(workInfo, 1);
+    execHistory->OnWorkStop(lightWork, 500, false);
+    heavyWork->priority_ = 0;
+    lightWork->priority_ = 1;
+    WorkQueue readyQueue;
+    for (const auto &work : {heavyWork, lightWork}) {
+        work->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        readyQueue.Push(work);
+    }
+    // one unit of a budget of two is taken: the heavy work costs 250, the light one 50.
+    const int32_t allowRunningCount = 2;
+    auto admit = [&weightedPolicy, allowRunningCount](const std::shared_ptr<WorkStatus> &work) {
+        return weightedPolicy.CanRun(work, allowRunningCount, 1);
+    };
+    if (WorkStatus::GetRunningCost() == 0) {
+        workInfo.SetWorkId(3);
+        auto runningWork = std::make_shared<WorkStatus>(workInfo, 1);
+        runningWork->MarkStatus(WorkStatus::Status::RUNNING);
+        EXPECT_FALSE(admit(heavyWork));
+        EXPECT_EQ(readyQueue.GetWorkToRunByPriority(nullptr, admit), lightWork);
+        runningWork->MarkStatus(WorkStatus::Status::REMOVED);
+    }
+    readyQueue.ClearAll();
+}
+}
+}
@@ -56,10 +56,10 @@ void WorkConnManagerTest::SetUpTestCase()
  */
 HWTEST_F(WorkConnManagerTest, AddConnInfo_001, TestSize.Level2)
 {
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     sptr<WorkSchedulerConnection> connection;
-    workConnManager_->AddConnInfo(workId, connection);
-    EXPECT_TRUE(workConnManager_->connMap_.count(workId) > 0);
+    workConnManager_->AddConnInfo(workKey, connection);
+    EXPECT_TRUE(workConnManager_->connMap_.count(workKey) > 0);
 }
 
 /**
@@ -70,11 +70,11 @@ HWTEST_F(WorkConnManagerTest, AddConnInfo_001, TestSize.Level2)
  */
 HWTEST_F(WorkConnManagerTest, RemoveConnInfo_001, TestSize.Level2)
 {
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     sptr<WorkSchedulerConnection> connection;
-    workConnManager_->AddConnInfo(workId, connection);
-    workConnManager_->RemoveConnInfo(workId);
-    EXPECT_FALSE(workConnManager_->connMap_.count(workId) > 0);
+    workConnManager_->AddConnInfo(workKey, connection);
+    workConnManager_->RemoveConnInfo(workKey);
+    EXPECT_FALSE(workConnManager_->connMap_.count(workKey) > 0);
 }
 
 /**
@@ -85,10 +85,10 @@ HWTEST_F(WorkConnManagerTest, RemoveConnInfo_001, TestSize.Level2)
  */
 HWTEST_F(WorkConnManagerTest, GetConnInfo_001, TestSize.Level2)
 {
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     sptr<WorkSchedulerConnection> connection;
-    workConnManager_->AddConnInfo(workId, connection);
-    workConnManager_->GetConnInfo(workId);
+    workConnManager_->AddConnInfo(workKey, connection);
+    workConnManager_->GetConnInfo(workKey);
     EXPECT_TRUE(workConnManager_->connMap_.size() == 1);
 }
 
@@ -101,8 +101,8 @@ HWTEST_F(WorkConnManagerTest, GetConnInfo_001, TestSize.Level2)
 HWTEST_F(WorkConnManagerTest, GetConnInfo_002, TestSize.Level2)
 {
     workConnManager_->connMap_.clear();
-    string workId = "u1000_123";
-    sptr<WorkSchedulerConnection> ret = workConnManager_->GetConnInfo(workId);
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
+    sptr<WorkSchedulerConnection> ret = workConnManager_->GetConnInfo(workKey);
     EXPECT_TRUE(ret == nullptr);
 }
 
@@ -114,9 +114,9 @@ HWTEST_F(WorkConnManagerTest, GetConnInfo_002, TestSize.Level2)
  */
 HWTEST_F(WorkConnManagerTest, StartWork_001, TestSize.Level2)
 {
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     sptr<WorkSchedulerConnection> connection;
-    workConnManager_->AddConnInfo(workId, connection);
+    workConnManager_->AddConnInfo(workKey, connection);
 
     WorkInfo workInfo;
     workInfo.workId_ = 123;
@@ -186,9 +186,9 @@ HWTEST_F(WorkConnManagerTest, StopWork_001, TestSize.Level2)
  */
 HWTEST_F(WorkConnManagerTest, StopWork_002, TestSize.Level2)
 {
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     sptr<WorkSchedulerConnection> connection;
-    workConnManager_->AddConnInfo(workId, connection);
+    workConnManager_->AddConnInfo(workKey, connection);
 
     WorkInfo workInfo;
     workInfo.workId_ = 123;
@@ -215,12 +215,12 @@ HWTEST_F(WorkConnManagerTest, StopWork_003, TestSize.Level2)
     workInfo.bundleName_ = "com.unittest.bundleName";
     workInfo.abilityName_ = "unittestAbility";
     int32_t uid = 1000;
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     shared_ptr<WorkStatus> workStatus = make_shared<WorkStatus>(workInfo, uid);
-    workStatus->workId_ = workId;
+    workStatus->workKey_ = workKey;
 
     sptr<WorkSchedulerConnection> connection(new (std::nothrow) WorkSchedulerConnection(workStatus->workInfo_));
-    myWorkConnManager.AddConnInfo(workId, connection);
+    myWorkConnManager.AddConnInfo(workKey, connection);
     bool ret = myWorkConnManager.StopWork(workStatus, false);
     EXPECT_TRUE(!ret);
 }
@@ -240,12 +240,12 @@ HWTEST_F(WorkConnManagerTest, StopWork_004, TestSize.Level2)
     workInfo.bundleName_ = "com.unittest.bundleName";
     workInfo.abilityName_ = "unittestAbility";
     int32_t uid = 1000;
-    string workId = "u1000_123";
+    WorkKey workKey = WorkStatus::MakeWorkKey(123, 1000);
     shared_ptr<WorkStatus> workStatus = make_shared<WorkStatus>(workInfo, uid);
-    workStatus->workId_ = workId;
+    workStatus->workKey_ = workKey;
 
     sptr<WorkSchedulerConnection> connection(new (std::nothrow) WorkSchedulerConnection(workStatus->workInfo_));
-    myWorkConnManager.AddConnInfo(workId, connection);
+    myWorkConnManager.AddConnInfo(workKey, connection);
     bool ret = myWorkConnManager.StopWork(workStatus, true);
     EXPECT_TRUE(ret);
 }
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "work_exec_history.h"
+#include "work_status.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace WorkScheduler {
+class WorkExecHistoryTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: OnWorkStop_001
+ * @tc.desc: Test WorkExecHistory OnWorkStop averages the duration and the timeout rate.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WorkExecHistoryTest, OnWorkStop_001, TestSize.Level1)
+{
+    WorkExecHistory execHistory;
+    WorkInfo workInfo;
+    workInfo.SetElement("com.example.workStatus", "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work = std::make_shared<WorkStatus>(workInfo, 1);
+    WorkExecHistory::Record record;
+    EXPECT_FALSE(execHistory.GetRecord(work->workKey_, record));
+    EXPECT_EQ(execHistory.GetRank(work), 0);
+
+    execHistory.OnWorkStop(work, 1000, false);
+    EXPECT_TRUE(execHistory.GetRecord(work->workKey_, record));
+    EXPECT_EQ(record.durationMs, 1000);
+    EXPECT_EQ(record.timeoutRate, 0);
+    EXPECT_EQ(record.runCount, 1);
+    EXPECT_EQ(execHistory.GetRank(work), 1000);
+
+    execHistory.OnWorkStop(work, 5000, true);
+    EXPECT_TRUE(execHistory.GetRecord(work->workKey_, record));
+    EXPECT_EQ(record.durationMs, 2000);
+    EXPECT_EQ(record.timeoutRate, 250);
+    EXPECT_EQ(record.lastDurationMs, 5000);
+    EXPECT_EQ(record.runCount, 2);
+    EXPECT_EQ(execHistory.GetRank(work), 3500);
+}
+
+/**
+ * @tc.name: OnWorkStop_002
+ * @tc.desc: Test WorkExecHistory OnWorkStop evicts the least recently run work when full.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WorkExecHistoryTest, OnWorkStop_002, TestSize.Level1)
+{
+    WorkExecHistory execHistory(2);
+    WorkInfo workInfo;
+    workInfo.SetElement("com.example.workStatus", "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work1 = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetWorkId(2);
+    auto work2 = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetWorkId(3);
+    auto work3 = std::make_shared<WorkStatus>(workInfo, 1);
+    execHistory.OnWorkStop(work1, 1000, false);
+    execHistory.OnWorkStop(work2, 1000, false);
+    execHistory.OnWorkStop(work1, 1000, false);
+    execHistory.OnWorkStop(work3, 1000, false);
+    WorkExecHistory::Record record;
+    EXPECT_TRUE(execHistory.GetRecord(work1->workKey_, record));
+    EXPECT_FALSE(execHistory.GetRecord(work2->workKey_, record));
+    EXPECT_TRUE(execHistory.GetRecord(work3->workKey_, record));
+}
+
+/**
+ * @tc.name: ParseFromJson_001
+ * @tc.desc: Test WorkExecHistory restores what it persisted.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WorkExecHistoryTest, ParseFromJson_001, TestSize.Level1)
+{
+    WorkExecHistory execHistory(2);
+    WorkInfo workInfo;
+    workInfo.SetElement("com.example.workStatus", "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work1 = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetWorkId(2);
+    auto work2 = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetWorkId(3);
+    auto work3 = std::make_shared<WorkStatus>(workInfo, 1);
+    const uint64_t now = 1000;
+    uint64_t delayMs = 0;
+    EXPECT_FALSE(execHistory.NeedPersist(now, delayMs));
+    execHistory.OnWorkStop(work1, 1000, true);
+    execHistory.OnWorkStop(work2, 2000, false);
+    uint64_t seq = 0;
+    std::string data = execHistory.ParseToJsonStr(seq);
+    execHistory.OnPersisted(seq, true, now);
+    EXPECT_FALSE(execHistory.IsDirty());
+
+    WorkExecHistory restored(2);
+    EXPECT_FALSE(restored.ParseFromJson(nlohmann::json::array()));
+    EXPECT_TRUE(restored.ParseFromJson(nlohmann::json::parse(data)));
+    WorkExecHistory::Record record;
+    EXPECT_TRUE(restored.GetRecord(work1->workKey_, record));
+    EXPECT_EQ(record.durationMs, 1000);
+    EXPECT_EQ(record.timeoutRate, 1000);
+    EXPECT_EQ(record.runCount, 1);
+    // work1 ran first, so it is evicted first.
+    restored.OnWorkStop(work3, 3000, false);
+    EXPECT_FALSE(restored.GetRecord(work1->workKey_, record));
+    EXPECT_TRUE(restored.GetRecord(work2->workKey_, record));
+    EXPECT_EQ(record.durationMs, 2000);
+}
+
+/**
+ * @tc.name: NeedPersist_001
+ * @tc.desc: Test WorkExecHistory NeedPersist posts one persist and keeps the runs a failed write missed.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WorkExecHistoryTest, NeedPersist_001, TestSize.Level1)
+{
+    WorkExecHistory execHistory;
+    WorkInfo workInfo;
+    workInfo.SetElement("com.example.workStatus", "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work = std::make_shared<WorkStatus>(workInfo, 1);
+    const uint64_t now = 1000;
+    const uint64_t interval = 10 * 60 * 1000;
+    uint64_t delayMs = 1;
+    execHistory.OnWorkStop(work, 1000, false);
+    EXPECT_TRUE(execHistory.NeedPersist(now, delayMs));
+    EXPECT_EQ(delayMs, 0);
+    EXPECT_FALSE(execHistory.NeedPersist(now, delayMs));
+    uint64_t seq = 0;
+    execHistory.ParseToJsonStr(seq);
+    // a run recorded while the file is written stays dirty.
+    execHistory.OnWorkStop(work, 1000, false);
+    execHistory.OnPersisted(seq, true, now);
+    EXPECT_TRUE(execHistory.IsDirty());
+
+    EXPECT_TRUE(execHistory.NeedPersist(now + 1000, delayMs));
+    EXPECT_EQ(delayMs, interval - 1000);
+    execHistory.ParseToJsonStr(seq);
+    execHistory.OnPersisted(seq, false, now + interval);
+    EXPECT_TRUE(execHistory.IsDirty());
+    EXPECT_TRUE(execHistory.NeedPersist(now + interval, delayMs));
+    EXPECT_EQ(delayMs, interval);
+    execHistory.ParseToJsonStr(seq);
+    execHistory.OnPersisted(seq, true, now + interval * 2);
+    EXPECT_FALSE(execHistory.IsDirty());
+}
+
+/**
+ * @tc.name: RemoveByUid_001
+ * @tc.desc: Test WorkExecHistory RemoveByUid only drops the records of that uid.
+ * @tc.type: FUNC
+ * @tc.require: I974IQ
+ */
+HWTEST_F(WorkExecHistoryTest, RemoveByUid_001, TestSize.Level1)
+{
+    WorkExecHistory execHistory;
+    WorkInfo workInfo;
+    workInfo.SetElement("com.example.workStatus", "workStatusAbility");
+    workInfo.SetWorkId(1);
+    auto work1 = std::make_shared<WorkStatus>(workInfo, 1);
+    workInfo.SetWorkId(1);
+    auto work2 = std::make_shared<WorkStatus>(workInfo, 2);
+    execHistory.OnWorkStop(work1, 1000, false);
+    execHistory.OnWorkStop(work2, 1000, false);
+    uint64_t seq = 0;
+    execHistory.ParseToJsonStr(seq);
+    execHistory.OnPersisted(seq, true, 1000);
+
+    execHistory.RemoveByUid(1);
+    EXPECT_TRUE(execHistory.IsDirty());
+    WorkExecHistory::Record record;
+    EXPECT_FALSE(execHistory.GetRecord(work1->workKey_, record));
+    EXPECT_TRUE(execHistory.GetRecord(work2->workKey_, record));
+    EXPECT_EQ(execHistory.GetRank(work1), 0);
+}
+}
+}
@@ -52,6 +52,18 @@ public:
     }
 };
 
+class MockSampledPolicyFilter : public MockPolicyFilter {
+public:
+    explicit MockSampledPolicyFilter(std::shared_ptr<WorkPolicyManager> workPolicyManager)
+        : MockPolicyFilter(workPolicyManager) {};
+    ~MockSampledPolicyFilter(){};
+
+    int64_t GetSampleTtlMs() override
+    {
+        return 60 * 1000;
+    }
+};
+
 class MockWorkConnManager : public WorkConnManager {
 public:
     bool StopWork(std::shared_ptr<WorkStatus> workStatus, bool isTimeOut)
@@ -937,6 +949,30 @@ HWTEST_F(WorkPolicyManagerTest, GetMaxRunningCount_007, TestSize.Level1)
     workPolicyManager_->policyFilters_.clear();
 }
 
+/**
+ * @tc.name: GetMaxRunningCount_008
+ * @tc.desc: Test WorkPolicyManagerTest GetMaxRunningCount with a sampled filter.
+ * @tc.type: FUNC
+ * @tc.require: I9J0A7
+ */
+HWTEST_F(WorkPolicyManagerTest, GetMaxRunningCount_008, TestSize.Level1)
+{
+    WorkSchedSystemPolicy systemPolicy;
+    workPolicyManager_->SetMaxRunningCountByDump(0);
+
+    auto filter = std::make_shared<MockSampledPolicyFilter>(workPolicyManager_);
+    filter->maxRunningCount = 2;
+    workPolicyManager_->AddPolicyFilter(filter);
+    EXPECT_EQ(2, workPolicyManager_->GetMaxRunningCount(systemPolicy));
+
+    filter->maxRunningCount = 1;
+    EXPECT_EQ(2, workPolicyManager_->GetMaxRunningCount(systemPolicy));
+
+    workPolicyManager_->InvalidatePolicySamples();
+    EXPECT_EQ(1, workPolicyManager_->GetMaxRunningCount(systemPolicy));
+    workPolicyManager_->policyFilters_.clear();
+}
+
 /**
  * @tc.name: GetRunningCount_001
  * @tc.desc: Test WorkPolicyManagerTest GetRunningCount.
@@ -952,11 +988,16 @@ HWTEST_F(WorkPolicyManagerTest, GetRunningCount_001, TestSize.Level1)
     workinfo.RequestDeepIdle(true);
     int32_t uid = 10000;
     std::shared_ptr<WorkStatus> workStatus = std::make_shared<WorkStatus>(workinfo, uid);
+    int32_t runningCount = workPolicyManager_->GetRunningCount();
     workStatus->MarkStatus(WorkStatus::Status::RUNNING);
     workPolicyManager_->AddWork(workStatus, uid);
 
     int32_t ret = workPolicyManager_->GetRunningCount();
-    EXPECT_TRUE(ret == 1);
+    EXPECT_TRUE(ret == runningCount + 1);
+    workStatus->MarkStatus(WorkStatus::Status::RUNNING);
+    EXPECT_EQ(workPolicyManager_->GetRunningCount(), runningCount + 1);
+    workStatus->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
+    EXPECT_EQ(workPolicyManager_->GetRunningCount(), runningCount);
 }
 
 /**
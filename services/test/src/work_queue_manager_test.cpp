@@ -124,5 +124,148 @@ HWTEST_F(WorkQueueManagerTest, ClearTimeOutWorkStatus_003, TestSize.Level1)
     workQueueManager_->ClearTimeOutWorkStatus();
     EXPECT_EQ(workQueueManager_->queueMap_.size(), 3);
 }
+/**
+ * @tc.name: GetConditionCandidates_001
+ * @tc.desc: Test WorkQueueManager GetConditionCandidates by battery level.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueManagerTest, GetConditionCandidates_001, TestSize.Level1)
+{
+    workQueueManager_->queueMap_.clear();
+    workQueueManager_->batteryLevelIndex_.clear();
+    workQueueManager_->pendingWorks_.clear();
+    workQueueManager_->lastConditionVal_.clear();
+    int32_t uid = 10000;
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    for (int32_t level : {20, 50, 80}) {
+        WorkInfo workinfo;
+        workinfo.SetWorkId(level);
+        workinfo.RequestBatteryLevel(level);
+        works.emplace_back(std::make_shared<WorkStatus>(workinfo, uid));
+        workQueueManager_->AddWork(works.back());
+    }
+    std::unordered_set<WorkKey, WorkKeyHash> candidates;
+    auto value = std::make_shared<DetectorValue>(30, 0, false, "");
+    EXPECT_FALSE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::BATTERY_LEVEL, value, candidates));
+
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(60, 0, false, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::BATTERY_LEVEL, value, candidates));
+    EXPECT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates.count(works[1]->workKey_), 1);
+
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(10, 0, false, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::BATTERY_LEVEL, value, candidates));
+    EXPECT_EQ(candidates.size(), 2);
+    EXPECT_EQ(candidates.count(works[0]->workKey_), 1);
+    EXPECT_EQ(candidates.count(works[1]->workKey_), 1);
+
+    workQueueManager_->RemoveWork(works[0]);
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(30, 0, false, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::BATTERY_LEVEL, value, candidates));
+    EXPECT_TRUE(candidates.empty());
+}
+
+/**
+ * @tc.name: GetConditionCandidates_002
+ * @tc.desc: Test WorkQueueManager GetConditionCandidates by network and charger.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueManagerTest, GetConditionCandidates_002, TestSize.Level1)
+{
+    workQueueManager_->queueMap_.clear();
+    workQueueManager_->networkIndex_.clear();
+    workQueueManager_->chargerIndex_.clear();
+    workQueueManager_->pendingWorks_.clear();
+    workQueueManager_->lastConditionVal_.clear();
+    int32_t uid = 10000;
+    WorkInfo anyInfo;
+    anyInfo.SetWorkId(1);
+    anyInfo.RequestNetworkType(WorkCondition::Network::NETWORK_TYPE_ANY);
+    anyInfo.RequestChargerType(false, WorkCondition::Charger::CHARGING_UNPLUGGED);
+    auto anyWork = std::make_shared<WorkStatus>(anyInfo, uid);
+    WorkInfo wifiInfo;
+    wifiInfo.SetWorkId(2);
+    wifiInfo.RequestNetworkType(WorkCondition::Network::NETWORK_TYPE_WIFI);
+    wifiInfo.RequestChargerType(true, WorkCondition::Charger::CHARGING_PLUGGED_AC);
+    auto wifiWork = std::make_shared<WorkStatus>(wifiInfo, uid);
+    workQueueManager_->AddWork(anyWork);
+    workQueueManager_->AddWork(wifiWork);
+
+    std::unordered_set<WorkKey, WorkKeyHash> candidates;
+    auto value = std::make_shared<DetectorValue>(WorkCondition::Network::NETWORK_TYPE_MOBILE, 0, false, "");
+    EXPECT_FALSE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::NETWORK, value, candidates));
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(WorkCondition::Network::NETWORK_TYPE_WIFI, 0, false, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::NETWORK, value, candidates));
+    EXPECT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates.count(wifiWork->workKey_), 1);
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(WorkCondition::Network::NETWORK_UNKNOWN, 0, false, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::NETWORK, value, candidates));
+    EXPECT_EQ(candidates.size(), 2);
+
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(WorkCondition::Charger::CHARGING_UNPLUGGED, 0, false, "");
+    EXPECT_FALSE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::CHARGER, value, candidates));
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(WorkCondition::Charger::CHARGING_PLUGGED_USB, 0, true, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::CHARGER, value, candidates));
+    EXPECT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates.count(anyWork->workKey_), 1);
+    candidates.clear();
+    value = std::make_shared<DetectorValue>(WorkCondition::Charger::CHARGING_PLUGGED_AC, 0, true, "");
+    EXPECT_TRUE(workQueueManager_->GetConditionCandidates(WorkCondition::Type::CHARGER, value, candidates));
+    EXPECT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates.count(wifiWork->workKey_), 1);
+}
+
+/**
+ * @tc.name: WorkRegistry_001
+ * @tc.desc: Test WorkQueueManager keeps a work once in the registry whatever conditions it requests.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueManagerTest, WorkRegistry_001, TestSize.Level1)
+{
+    workQueueManager_->queueMap_.clear();
+    workQueueManager_->workRegistry_->ClearAll();
+    WorkInfo workinfo;
+    workinfo.SetWorkId(10000);
+    workinfo.RequestBatteryStatus(WorkCondition::BatteryStatus::BATTERY_STATUS_LOW);
+    workinfo.RequestBatteryLevel(80);
+    workinfo.RequestStorageLevel(WorkCondition::Storage::STORAGE_LEVEL_OKAY);
+    auto workStatus = std::make_shared<WorkStatus>(workinfo, 10000);
+    workQueueManager_->AddWork(workStatus);
+    workQueueManager_->AddWork(workStatus);
+    EXPECT_EQ(workQueueManager_->queueMap_.size(), 3);
+    EXPECT_EQ(workQueueManager_->workRegistry_->GetSize(), 1);
+    workQueueManager_->RemoveWork(workStatus);
+    EXPECT_EQ(workQueueManager_->workRegistry_->GetSize(), 0);
+}
+
+/**
+ * @tc.name: IsCoalescedType_001
+ * @tc.desc: Test WorkQueueManager IsCoalescedType and SetCoalesceWindow.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueManagerTest, IsCoalescedType_001, TestSize.Level1)
+{
+    EXPECT_TRUE(WorkQueueManager::IsCoalescedType(WorkCondition::Type::BATTERY_LEVEL));
+    EXPECT_TRUE(WorkQueueManager::IsCoalescedType(WorkCondition::Type::NETWORK));
+    EXPECT_FALSE(WorkQueueManager::IsCoalescedType(WorkCondition::Type::TIMER));
+    EXPECT_FALSE(WorkQueueManager::IsCoalescedType(WorkCondition::Type::GROUP));
+    EXPECT_FALSE(WorkQueueManager::IsCoalescedType(WorkCondition::Type::DEEP_IDLE));
+
+    int64_t windowMs = workQueueManager_->coalesceWindowMs_.load();
+    workQueueManager_->SetCoalesceWindow(0);
+    EXPECT_EQ(workQueueManager_->coalesceWindowMs_.load(), 0);
+    workQueueManager_->SetCoalesceWindow(windowMs);
+}
 }
 }
\ No newline at end of file
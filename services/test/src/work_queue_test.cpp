@@ -13,9 +13,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <functional>
+#include <map>
 #include <gtest/gtest.h>
 
+#include "system_state_snapshot.h"
 #include "work_queue.h"
 #include "work_status.h"
 #include "work_scheduler_service.h"
@@ -167,6 +170,25 @@ HWTEST_F(WorkQueueTest, ParseCondition_009, TestSize.Level1)
     EXPECT_FALSE(ret->boolVal);
 }
 
+/**
+ * @tc.name: GetEventCondition_001
+ * @tc.desc: Test WorkQueue GetEventCondition shares the condition of the published system state.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetEventCondition_001, TestSize.Level1)
+{
+    std::shared_ptr<DetectorValue> value = std::make_shared<DetectorValue>(1, 0, false, "");
+    auto published = workQueue_->ParseCondition(WorkCondition::Type::STORAGE, value);
+    SystemStateSnapshot::Publish(std::make_shared<const SystemStateSnapshot>(SystemStateSnapshot::GetCurrent(),
+        WorkCondition::Type::STORAGE, published));
+    EXPECT_EQ(workQueue_->GetEventCondition(WorkCondition::Type::STORAGE, value), published);
+
+    auto timerCondition = workQueue_->GetEventCondition(WorkCondition::Type::TIMER, value);
+    EXPECT_NE(timerCondition, nullptr);
+    EXPECT_NE(timerCondition, published);
+}
+
 /**
  * @tc.name: Push_001
  * @tc.desc: Test WorkQueue Push.
@@ -271,6 +293,28 @@ HWTEST_F(WorkQueueTest, Contains_002, TestSize.Level1)
     EXPECT_FALSE(ret);
 }
 
+/**
+ * @tc.name: Contains_003
+ * @tc.desc: Test WorkQueue Contains with malformed work ids.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, Contains_003, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    auto workInfo_ = WorkInfo();
+    workInfo_.SetWorkId(1);
+    workInfo_.SetElement("com.example.workStatus", "workStatusAbility");
+    auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+    workQueue_->Push(workStatus);
+    EXPECT_FALSE(workQueue_->Contains(std::shared_ptr<std::string>()));
+    EXPECT_FALSE(workQueue_->Contains(std::make_shared<std::string>("")));
+    EXPECT_FALSE(workQueue_->Contains(std::make_shared<std::string>("u1")));
+    EXPECT_FALSE(workQueue_->Contains(std::make_shared<std::string>("x1_1")));
+    EXPECT_FALSE(workQueue_->Contains(std::make_shared<std::string>("u1_1x")));
+    EXPECT_TRUE(workQueue_->Contains(std::make_shared<std::string>("u1_1")));
+}
+
 /**
  * @tc.name: Find_001
  * @tc.desc: Test WorkQueue Find.
@@ -311,6 +355,34 @@ HWTEST_F(WorkQueueTest, Find_002, TestSize.Level1)
     EXPECT_FALSE(ret);
 }
 
+/**
+ * @tc.name: Find_003
+ * @tc.desc: Test WorkQueue Find and Contains by workKey after remove.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, Find_003, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    auto workInfo_ = WorkInfo();
+    workInfo_.SetWorkId(1);
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    workInfo_.SetElement(bundleName, abilityName);
+    auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+    auto sameIdWork = std::make_shared<WorkStatus>(workInfo_, 1);
+    workQueue_->Push(workStatus);
+    workQueue_->Push(sameIdWork);
+    EXPECT_EQ(workQueue_->GetSize(), 1);
+    EXPECT_TRUE(workQueue_->Contains(workStatus->workKey_));
+    EXPECT_EQ(workQueue_->Find(workStatus->workKey_), workStatus);
+    workQueue_->Remove(sameIdWork);
+    EXPECT_EQ(workQueue_->Find(workStatus->workKey_), workStatus);
+    workQueue_->Remove(workStatus);
+    EXPECT_FALSE(workQueue_->Contains(workStatus->workKey_));
+    EXPECT_EQ(workQueue_->Find(workStatus->workKey_), nullptr);
+}
+
 /**
  * @tc.name: GetWorkToRunByPriority_001
  * @tc.desc: Test WorkQueue GetWorkToRunByPriority.
@@ -332,6 +404,197 @@ HWTEST_F(WorkQueueTest, GetWorkToRunByPriority_001, TestSize.Level1)
     EXPECT_TRUE(ret != nullptr);
 }
 
+/**
+ * @tc.name: GetWorkToRunByPriority_002
+ * @tc.desc: Test WorkQueue GetWorkToRunByPriority picks the lowest priority ready work in turn.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetWorkToRunByPriority_002, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    for (int32_t i = 1; i <= 3; i++) {
+        auto workInfo_ = WorkInfo();
+        workInfo_.SetWorkId(i);
+        workInfo_.SetElement(bundleName, abilityName);
+        auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+        workStatus->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        workQueue_->Push(workStatus);
+        works.emplace_back(workStatus);
+    }
+    works[0]->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
+    int32_t priority = works[1]->priority_;
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(), works[1]);
+    EXPECT_EQ(works[1]->priority_, priority + 1);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(), works[2]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(), works[1]);
+    workQueue_->CancelWork(works[2]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(), works[1]);
+    EXPECT_EQ(workQueue_->GetSize(), 2);
+}
+
+/**
+ * @tc.name: GetWorkToRunByPriority_003
+ * @tc.desc: Test WorkQueue GetWorkToRunByPriority sees priority changes made by another queue.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetWorkToRunByPriority_003, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    auto otherQueue = std::make_shared<WorkQueue>();
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    for (int32_t i = 1; i <= 2; i++) {
+        auto workInfo_ = WorkInfo();
+        workInfo_.SetWorkId(i);
+        workInfo_.SetElement(bundleName, abilityName);
+        auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+        workStatus->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        workQueue_->Push(workStatus);
+        otherQueue->Push(workStatus);
+        works.emplace_back(workStatus);
+    }
+    EXPECT_EQ(otherQueue->GetWorkToRunByPriority(), works[0]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(), works[1]);
+}
+
+/**
+ * @tc.name: GetWorkToRunByPriority_004
+ * @tc.desc: Test WorkQueue GetWorkToRunByPriority orders the ready works of the lowest priority by rank.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetWorkToRunByPriority_004, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    std::map<std::shared_ptr<WorkStatus>, uint64_t> ranks;
+    const uint64_t workRanks[] = {300, 100, 200, 0};
+    for (int32_t i = 0; i < 4; i++) {
+        auto workInfo_ = WorkInfo();
+        workInfo_.SetWorkId(i + 1);
+        workInfo_.SetElement(bundleName, abilityName);
+        auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+        workStatus->priority_ = 0;
+        workStatus->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        ranks[workStatus] = workRanks[i];
+        works.emplace_back(workStatus);
+    }
+    works[3]->priority_ = 5;
+    for (const auto &work : works) {
+        workQueue_->Push(work);
+    }
+    auto rank = [&ranks](const std::shared_ptr<WorkStatus> &work) { return ranks[work]; };
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(rank), works[1]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(rank), works[2]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(rank), works[0]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(rank), works[1]);
+    workQueue_->ClearAll();
+}
+
+/**
+ * @tc.name: GetWorkToRunByPriority_005
+ * @tc.desc: Test WorkQueue GetWorkToRunByPriority still finds a ready work picked by another queue.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetWorkToRunByPriority_005, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    auto otherQueue = std::make_shared<WorkQueue>();
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    for (int32_t i = 1; i <= 3; i++) {
+        auto workInfo_ = WorkInfo();
+        workInfo_.SetWorkId(i);
+        workInfo_.SetElement(bundleName, abilityName);
+        auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+        workStatus->priority_ = 0;
+        workStatus->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
+        workQueue_->Push(workStatus);
+        works.emplace_back(workStatus);
+    }
+    works[0]->MarkStatus(WorkStatus::Status::CONDITION_READY);
+    otherQueue->Push(works[0]);
+    EXPECT_EQ(otherQueue->GetWorkToRunByPriority(), works[0]);
+    EXPECT_EQ(otherQueue->GetWorkToRunByPriority(), works[0]);
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(), works[0]);
+    EXPECT_EQ(works[0]->priority_, 3);
+    workQueue_->ClearAll();
+}
+
+/**
+ * @tc.name: GetWorkToRunByPriority_006
+ * @tc.desc: Test WorkQueue GetWorkToRunByPriority passes over a heavy top work that is not admitted.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetWorkToRunByPriority_006, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    for (int32_t i = 1; i <= 2; i++) {
+        auto workInfo_ = WorkInfo();
+        workInfo_.SetWorkId(i);
+        workInfo_.SetElement(bundleName, abilityName);
+        auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+        workStatus->priority_ = i;
+        workStatus->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        workQueue_->Push(workStatus);
+        works.emplace_back(workStatus);
+    }
+    // works[0] is the top work but too heavy for the budget left.
+    auto heavyWork = works[0];
+    auto admit = [heavyWork](const std::shared_ptr<WorkStatus> &work) { return work != heavyWork; };
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(nullptr, admit), works[1]);
+    EXPECT_EQ(works[0]->priority_, 1);
+    auto admitNone = [](const std::shared_ptr<WorkStatus> &work) { return false; };
+    EXPECT_EQ(workQueue_->GetWorkToRunByPriority(nullptr, admitNone), works[0]);
+    workQueue_->ClearAll();
+}
+
+/**
+ * @tc.name: OnConditionChanged_001
+ * @tc.desc: Test WorkQueue OnConditionChanged with candidates still judges the ready works.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, OnConditionChanged_001, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    std::string bundleName = "com.example.workStatus";
+    std::string abilityName = "workStatusAbility";
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    for (int32_t i = 1; i <= 2; i++) {
+        auto workInfo_ = WorkInfo();
+        workInfo_.SetWorkId(i);
+        workInfo_.SetElement(bundleName, abilityName);
+        auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+        workStatus->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
+        workQueue_->Push(workStatus);
+        works.emplace_back(workStatus);
+    }
+    works[1]->MarkStatus(WorkStatus::Status::CONDITION_READY);
+    auto value = std::make_shared<DetectorValue>(0, 0, 0, std::string());
+    std::unordered_set<WorkKey, WorkKeyHash> candidates;
+    auto result = workQueue_->OnConditionChanged(WorkCondition::Type::STORAGE, value, candidates);
+    EXPECT_EQ(std::count(result.begin(), result.end(), works[0]), 0);
+    // the ready work is either emitted again or falls back to waiting, it is never skipped.
+    bool judged = std::count(result.begin(), result.end(), works[1]) > 0 || !works[1]->IsReadyStatus();
+    EXPECT_TRUE(judged);
+    workQueue_->ClearAll();
+}
+
 /**
  * @tc.name: CancelWork_001
  * @tc.desc: Test WorkQueue CancelWork.
@@ -455,5 +718,29 @@ HWTEST_F(WorkQueueTest, GetDeepIdleWorks_001, TestSize.Level1)
     workQueue_->Push(workStatus);
     EXPECT_TRUE(workQueue_->GetDeepIdleWorks().size() == 1);
 }
+/**
+ * @tc.name: GetSnapshot_001
+ * @tc.desc: Test WorkQueue shares one snapshot until the queue changes.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(WorkQueueTest, GetSnapshot_001, TestSize.Level1)
+{
+    workQueue_->ClearAll();
+    auto workInfo_ = WorkInfo();
+    workInfo_.SetWorkId(1);
+    auto workStatus = std::make_shared<WorkStatus>(workInfo_, 1);
+    workQueue_->Push(workStatus);
+    auto snapshot = workQueue_->GetSnapshot();
+    EXPECT_EQ(snapshot->size(), 1);
+    EXPECT_EQ(workQueue_->GetSnapshot(), snapshot);
+
+    workQueue_->Remove(workStatus);
+    EXPECT_EQ(snapshot->size(), 1);
+    EXPECT_TRUE(workQueue_->GetSnapshot()->empty());
+    int32_t count = 0;
+    workQueue_->ForEach([&count](const std::shared_ptr<WorkStatus> &work) { count++; });
+    EXPECT_EQ(count, 0);
+}
 }
 }
\ No newline at end of file
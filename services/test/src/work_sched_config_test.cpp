@@ -84,6 +84,22 @@ HWTEST_F(WorkSchedConfigTest, IsInActiveGroupWhitelist_CheckSignature, TestSize.
     EXPECT_FALSE(DelayedSingleton<WorkSchedulerConfig>::GetInstance()->IsInActiveGroupWhitelist("invalid_bundle"));
 }
 
+/**
+ * @tc.name: IsInActiveGroupWhitelist_SignatureCache
+ * @tc.desc: Test IsInActiveGroupWhitelist uses the signature cache until it is cleared.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WorkSchedConfigTest, IsInActiveGroupWhitelist_SignatureCache, TestSize.Level3)
+{
+    auto config = DelayedSingleton<WorkSchedulerConfig>::GetInstance();
+    config->activeGroupWhitelist_.insert("invalid_bundle");
+    config->signatureCache_["invalid_bundle"] = true;
+    EXPECT_TRUE(config->IsInActiveGroupWhitelist("invalid_bundle"));
+    config->ClearSignatureCache("invalid_bundle");
+    EXPECT_FALSE(config->IsInActiveGroupWhitelist("invalid_bundle"));
+    EXPECT_EQ(config->signatureCache_.count("invalid_bundle"), 1);
+}
+
 /**
  * @tc.name: InitActiveGroupWhitelist_002
  * @tc.desc: test active_group_whitelist
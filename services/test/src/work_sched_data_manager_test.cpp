@@ -137,5 +137,36 @@ HWTEST_F(DataManagerTest, SetDeviceSleep_001, TestSize.Level1)
     dataManager_->SetDeviceSleep(false);
     EXPECT_FALSE(dataManager_->GetDeviceSleep());
 }
+
+/**
+ * @tc.name: AddMailApp_001
+ * @tc.desc: Test DataManager AddMailApp and ClearMailApp.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(DataManagerTest, AddMailApp_001, TestSize.Level1)
+{
+    bool isMailApp = false;
+    dataManager_->ClearMailApp("bundleName1");
+    EXPECT_FALSE(dataManager_->FindMailApp("bundleName1", isMailApp));
+    dataManager_->AddMailApp("bundleName1", true);
+    EXPECT_TRUE(dataManager_->FindMailApp("bundleName1", isMailApp));
+    EXPECT_TRUE(isMailApp);
+    dataManager_->ClearMailApp("bundleName1");
+    EXPECT_FALSE(dataManager_->FindMailApp("bundleName1", isMailApp));
+}
+
+/**
+ * @tc.name: IsUserActive_001
+ * @tc.desc: Test DataManager IsUserActive.
+ * @tc.type: FUNC
+ * @tc.require: I8JBRY
+ */
+HWTEST_F(DataManagerTest, IsUserActive_001, TestSize.Level1)
+{
+    dataManager_->activeUsers_ = std::make_shared<std::set<int32_t>>(std::set<int32_t>{100});
+    EXPECT_TRUE(dataManager_->IsUserActive(100));
+    EXPECT_FALSE(dataManager_->IsUserActive(101));
+}
 }
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <functional>
 #include <gtest/gtest.h>
 
@@ -80,6 +81,23 @@ HWTEST_F(WorkStatusTest, makeWorkId_001, TestSize.Level1)
     EXPECT_EQ(result, "u1_1");
 }
 
+/**
+ * @tc.name: makeWorkKey_001
+ * @tc.desc: Test WorkStatus MakeWorkKey.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, makeWorkKey_001, TestSize.Level1)
+{
+    WorkKey key = workStatus_->MakeWorkKey(2, 1);
+    EXPECT_EQ(key.ToString(), workStatus_->MakeWorkId(2, 1));
+    EXPECT_EQ(key.Value(), (static_cast<uint64_t>(1) << 32) | 2);
+    EXPECT_TRUE(key == WorkKey(1, 2));
+    EXPECT_TRUE(key != workStatus_->MakeWorkKey(1, 2));
+    EXPECT_TRUE(workStatus_->MakeWorkKey(1, -1) != workStatus_->MakeWorkKey(-1, 1));
+    EXPECT_EQ(workStatus_->MakeWorkKey(1, -1).ToString(), "u-1_1");
+}
+
 /**
  * @tc.name: isSameUser_001
  * @tc.desc: Test WorkStatus IsSameUser.
@@ -528,6 +546,29 @@ HWTEST_F(WorkStatusTest, isRepeating_001, TestSize.Level1)
     EXPECT_TRUE(ret2);
 }
 
+/**
+ * @tc.name: GetActiveWorks_001
+ * @tc.desc: Test WorkStatus GetActiveWorks follows MarkStatus.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, GetActiveWorks_001, TestSize.Level1)
+{
+    auto isActive = [this]() {
+        std::vector<WorkKey> workKeys;
+        WorkStatus::GetActiveWorks(workKeys);
+        return std::count(workKeys.begin(), workKeys.end(), workStatus_->workKey_) > 0;
+    };
+    workStatus_->MarkStatus(WorkStatus::Status::WAIT_CONDITION);
+    EXPECT_FALSE(isActive());
+    workStatus_->MarkStatus(WorkStatus::Status::CONDITION_READY);
+    EXPECT_TRUE(isActive());
+    workStatus_->MarkStatus(WorkStatus::Status::RUNNING);
+    EXPECT_TRUE(isActive());
+    workStatus_->MarkStatus(WorkStatus::Status::REMOVED);
+    EXPECT_FALSE(isActive());
+}
+
 /**
  * @tc.name: IsReadyStatus_001
  * @tc.desc: Test WorkStatus IsReadyStatus.
@@ -1034,11 +1075,11 @@ HWTEST_F(WorkStatusTest, IsSAReady_0014, TestSize.Level1)
  */
 HWTEST_F(WorkStatusTest, ToString_001, TestSize.Level1)
 {
-    workStatus_->conditionStatus_.clear();
+    workStatus_->conditionStatus_.Clear();
     std::shared_ptr<DataManager> dataManager = DelayedSingleton<DataManager>::GetInstance();
     dataManager->SetDeviceSleep(false);
     workStatus_->ToString(WorkCondition::Type::TIMER);
-    EXPECT_TRUE(workStatus_->conditionStatus_.empty());
+    EXPECT_TRUE(workStatus_->conditionStatus_.IsEmpty());
 }
 
 /**
@@ -1049,14 +1090,14 @@ HWTEST_F(WorkStatusTest, ToString_001, TestSize.Level1)
  */
 HWTEST_F(WorkStatusTest, ToString_002, TestSize.Level1)
 {
-    workStatus_->conditionStatus_.clear();
+    workStatus_->conditionStatus_.Clear();
     std::shared_ptr<DataManager> dataManager = DelayedSingleton<DataManager>::GetInstance();
     dataManager->SetDeviceSleep(false);
-    workStatus_->conditionStatus_ = "TIMER&ready";
+    workStatus_->conditionStatus_.SetResult(WorkCondition::Type::TIMER, true);
     workStatus_->workInfo_->saId_ = 1000;
     workStatus_->workInfo_->residentSa_ = true;
     workStatus_->ToString(WorkCondition::Type::TIMER);
-    EXPECT_FALSE(workStatus_->conditionStatus_.empty());
+    EXPECT_FALSE(workStatus_->conditionStatus_.IsEmpty());
 }
 
 /**
@@ -1067,12 +1108,33 @@ HWTEST_F(WorkStatusTest, ToString_002, TestSize.Level1)
  */
 HWTEST_F(WorkStatusTest, ToString_003, TestSize.Level1)
 {
-    workStatus_->conditionStatus_.clear();
+    workStatus_->conditionStatus_.Clear();
     std::shared_ptr<DataManager> dataManager = DelayedSingleton<DataManager>::GetInstance();
     dataManager->SetDeviceSleep(false);
-    workStatus_->conditionStatus_ = "TIMER&ready";
+    workStatus_->conditionStatus_.SetResult(WorkCondition::Type::TIMER, true);
     workStatus_->ToString(WorkCondition::Type::TIMER);
-    EXPECT_FALSE(workStatus_->conditionStatus_.empty());
+    EXPECT_FALSE(workStatus_->conditionStatus_.IsEmpty());
+}
+
+/**
+ * @tc.name: ToString_004
+ * @tc.desc: Test WorkStatus condition status is formatted in the judging order.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, ToString_004, TestSize.Level1)
+{
+    workStatus_->conditionStatus_.Clear();
+    EXPECT_TRUE(workStatus_->conditionStatus_.Format().empty());
+    workStatus_->conditionStatus_.SetResult(WorkCondition::Type::STANDBY, false);
+    workStatus_->conditionStatus_.SetFlag(WorkStatus::ConditionStatus::URI_KEY_OFF);
+    workStatus_->conditionStatus_.SetNotOk(WorkCondition::Type::TIMER, 100, 200);
+    workStatus_->conditionStatus_.SetResult(WorkCondition::Type::NETWORK, true);
+    EXPECT_EQ(workStatus_->conditionStatus_.Format(), ",NETWORK&1,TIMER&0(100:200),uriKeyOFF,STANDBY&0");
+
+    workStatus_->conditionStatus_.Clear();
+    workStatus_->conditionStatus_.SetNotOk(WorkCondition::Type::GROUP, 10, 7200000);
+    EXPECT_EQ(workStatus_->conditionStatus_.Format(), ",GROUP&0(10:7200000)");
 }
 
 /**
@@ -1131,6 +1193,46 @@ HWTEST_F(WorkStatusTest, IsChargingState_001, TestSize.Level1)
     EXPECT_TRUE(isChargingState);
 }
 
+/**
+ * @tc.name: IsChargingState_002
+ * @tc.desc: Test IsChargingState with the charger type reported to DataManager.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, IsChargingState_002, TestSize.Level1)
+{
+    auto dataManager = DelayedSingleton<DataManager>::GetInstance();
+    dataManager->SetChargerSubscribed(true);
+    dataManager->SetChargerType(WorkCondition::Charger::CHARGING_UNPLUGGED);
+    EXPECT_FALSE(workStatus_->IsChargingState());
+    dataManager->SetChargerType(WorkCondition::Charger::CHARGING_PLUGGED_AC);
+    EXPECT_TRUE(workStatus_->IsChargingState());
+    dataManager->SetChargerSubscribed(false);
+}
+
+/**
+ * @tc.name: IsChargingState_003
+ * @tc.desc: Test DataManager keeps the charger type only while the charger listener is subscribed.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, IsChargingState_003, TestSize.Level1)
+{
+    auto dataManager = DelayedSingleton<DataManager>::GetInstance();
+    dataManager->SetChargerSubscribed(false);
+    dataManager->SetChargerType(WorkCondition::Charger::CHARGING_PLUGGED_AC);
+    EXPECT_EQ(dataManager->GetChargerType(), WorkCondition::Charger::CHARGING_UNKNOWN);
+
+    dataManager->SetChargerSubscribed(true);
+    dataManager->InitChargerType(WorkCondition::Charger::CHARGING_PLUGGED_USB);
+    EXPECT_EQ(dataManager->GetChargerType(), WorkCondition::Charger::CHARGING_PLUGGED_USB);
+    dataManager->InitChargerType(WorkCondition::Charger::CHARGING_UNPLUGGED);
+    EXPECT_EQ(dataManager->GetChargerType(), WorkCondition::Charger::CHARGING_PLUGGED_USB);
+
+    dataManager->SetChargerSubscribed(false);
+    EXPECT_EQ(dataManager->GetChargerType(), WorkCondition::Charger::CHARGING_UNKNOWN);
+}
+
 /**
  * @tc.name: IsMailApp_001
  * @tc.desc: Test IsMailApp.
@@ -1478,5 +1580,152 @@ HWTEST_F(WorkStatusTest, HandleMinInterval_005, TestSize.Level1)
     EXPECT_EQ(resultInterval, -1);
     service->ClearExecFrequency();
 }
+
+/**
+ * @tc.name: IsConditionReady_001
+ * @tc.desc: Test WorkStatus IsConditionReady only re-judges the conditions changed in the system state snapshot.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, IsConditionReady_001, TestSize.Level1)
+{
+    auto publish = [](WorkCondition::Type type, std::shared_ptr<Condition> value) {
+        SystemStateSnapshot::Publish(
+            std::make_shared<const SystemStateSnapshot>(SystemStateSnapshot::GetCurrent(), type, value));
+    };
+    WorkInfo workInfo = WorkInfo();
+    workInfo.SetWorkId(1);
+    workInfo.RequestBatteryLevel(60);
+    workInfo.RequestNetworkType(WorkCondition::Network::NETWORK_TYPE_ANY);
+    std::shared_ptr<WorkStatus> workStatus = std::make_shared<WorkStatus>(workInfo, 1);
+    uint32_t requiredMask = ConditionSlots::TypeBit(WorkCondition::Type::BATTERY_LEVEL) |
+        ConditionSlots::TypeBit(WorkCondition::Type::NETWORK);
+    EXPECT_EQ(workStatus->workInfo_->GetConditionMask(), requiredMask);
+    EXPECT_EQ(workStatus->workInfo_->GetCondition(WorkCondition::Type::BATTERY_LEVEL)->intVal, 60);
+    EXPECT_EQ(workStatus->workInfo_->GetCondition(WorkCondition::Type::STORAGE), nullptr);
+
+    std::shared_ptr<Condition> batteryLevel = std::make_shared<Condition>();
+    batteryLevel->intVal = 50;
+    publish(WorkCondition::Type::BATTERY_LEVEL, batteryLevel);
+    std::shared_ptr<Condition> network = std::make_shared<Condition>();
+    network->enumVal = WorkCondition::Network::NETWORK_TYPE_WIFI;
+    publish(WorkCondition::Type::NETWORK, network);
+    workStatus->UpdateCondition(WorkCondition::Type::NETWORK, network);
+    EXPECT_EQ(workStatus->conditionMap_.count(WorkCondition::Type::NETWORK), 0);
+    EXPECT_FALSE(workStatus->IsConditionReady());
+    EXPECT_EQ(workStatus->satisfiedMask_, ConditionSlots::TypeBit(WorkCondition::Type::NETWORK));
+    EXPECT_EQ(workStatus->GetCurrentCondition(WorkCondition::Type::BATTERY_LEVEL), batteryLevel);
+
+    std::shared_ptr<Condition> batteryLevelOk = std::make_shared<Condition>();
+    batteryLevelOk->intVal = 70;
+    publish(WorkCondition::Type::BATTERY_LEVEL, batteryLevelOk);
+    EXPECT_TRUE(workStatus->IsConditionReady());
+    EXPECT_EQ(workStatus->satisfiedMask_, requiredMask);
+
+    publish(WorkCondition::Type::BATTERY_LEVEL, batteryLevel);
+    EXPECT_FALSE(workStatus->IsConditionReady());
+    SystemStateSnapshot::Publish(nullptr);
+}
+
+/**
+ * @tc.name: UpdateCondition_001
+ * @tc.desc: Test WorkStatus keeps only the deep idle of one SA as its own condition.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, UpdateCondition_001, TestSize.Level1)
+{
+    WorkInfo workInfo = WorkInfo();
+    workInfo.SetWorkId(1);
+    workInfo.RequestDeepIdle(true);
+    std::shared_ptr<WorkStatus> workStatus = std::make_shared<WorkStatus>(workInfo, 1);
+    std::shared_ptr<Condition> deepIdle = std::make_shared<Condition>();
+    deepIdle->boolVal = true;
+    deepIdle->enumVal = 1000;
+    workStatus->UpdateCondition(WorkCondition::Type::DEEP_IDLE, deepIdle);
+    EXPECT_EQ(workStatus->GetCurrentCondition(WorkCondition::Type::DEEP_IDLE), deepIdle);
+
+    std::shared_ptr<Condition> systemDeepIdle = std::make_shared<Condition>();
+    systemDeepIdle->enumVal = 0;
+    SystemStateSnapshot::Publish(std::make_shared<const SystemStateSnapshot>(nullptr,
+        WorkCondition::Type::DEEP_IDLE, systemDeepIdle));
+    workStatus->UpdateCondition(WorkCondition::Type::DEEP_IDLE, systemDeepIdle);
+    EXPECT_EQ(workStatus->conditionMap_.count(WorkCondition::Type::DEEP_IDLE), 0);
+    EXPECT_EQ(workStatus->GetCurrentCondition(WorkCondition::Type::DEEP_IDLE), systemDeepIdle);
+    SystemStateSnapshot::Publish(nullptr);
+}
+/**
+ * @tc.name: TakeTimeoutWorks_001
+ * @tc.desc: Test WorkStatus hands every timed out work over once.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, TakeTimeoutWorks_001, TestSize.Level1)
+{
+    WorkStatus::TakeTimeoutWorks();
+    WorkInfo workInfo = WorkInfo();
+    workInfo.SetWorkId(1);
+    std::shared_ptr<WorkStatus> workStatus = std::make_shared<WorkStatus>(workInfo, 1);
+    workStatus->SetTimeout(false);
+    EXPECT_TRUE(WorkStatus::TakeTimeoutWorks().empty());
+    workStatus->SetTimeout(true);
+    auto timeoutWorks = WorkStatus::TakeTimeoutWorks();
+    EXPECT_EQ(timeoutWorks.size(), 1);
+    EXPECT_EQ(timeoutWorks.count(workStatus->workKey_), 1);
+    EXPECT_TRUE(WorkStatus::TakeTimeoutWorks().empty());
+}
+
+/**
+ * @tc.name: TakeDueTimeoutDeadline_001
+ * @tc.desc: Test WorkStatus reports the earliest armed timeout deadline once it passed.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, TakeDueTimeoutDeadline_001, TestSize.Level1)
+{
+    WorkStatus::TakeDueTimeoutDeadline(UINT64_MAX - 1);
+    EXPECT_FALSE(WorkStatus::TakeDueTimeoutDeadline(UINT64_MAX - 1));
+    WorkInfo workInfo = WorkInfo();
+    workInfo.SetWorkId(1);
+    std::shared_ptr<WorkStatus> workStatus = std::make_shared<WorkStatus>(workInfo, 1);
+    workStatus->workStartTime_ = 1000;
+    workStatus->workWatchDogTime_ = 2000;
+    workStatus->ArmTimeoutDeadline();
+    uint64_t deadline = WorkStatus::s_timeout_deadline.load();
+    EXPECT_GT(deadline, 3000);
+    EXPECT_FALSE(WorkStatus::TakeDueTimeoutDeadline(deadline));
+    EXPECT_TRUE(WorkStatus::TakeDueTimeoutDeadline(deadline + 1));
+    EXPECT_FALSE(WorkStatus::TakeDueTimeoutDeadline(deadline + 1));
+}
+
+/**
+ * @tc.name: GetUidRunningCount_001
+ * @tc.desc: Test WorkStatus counts running works per uid and bundle on status transitions.
+ * @tc.type: FUNC
+ * @tc.require: I95QHG
+ */
+HWTEST_F(WorkStatusTest, GetUidRunningCount_001, TestSize.Level1)
+{
+    int32_t uid = 20001;
+    std::string bundleName = "com.example.runningCount";
+    WorkInfo workInfo = WorkInfo();
+    workInfo.SetWorkId(1);
+    workInfo.SetElement(bundleName, "MainAbility");
+    int32_t runningCount = WorkStatus::GetRunningCount();
+    {
+        std::shared_ptr<WorkStatus> workStatus = std::make_shared<WorkStatus>(workInfo, uid);
+        workStatus->MarkStatus(WorkStatus::Status::RUNNING);
+        workStatus->MarkStatus(WorkStatus::Status::RUNNING);
+        EXPECT_EQ(WorkStatus::GetRunningCount(), runningCount + 1);
+        EXPECT_EQ(WorkStatus::GetUidRunningCount(uid), 1);
+        EXPECT_EQ(WorkStatus::GetBundleRunningCount(bundleName), 1);
+        workStatus->MarkStatus(WorkStatus::Status::REMOVED);
+        EXPECT_EQ(WorkStatus::GetUidRunningCount(uid), 0);
+        workStatus->MarkStatus(WorkStatus::Status::RUNNING);
+    }
+    EXPECT_EQ(WorkStatus::GetRunningCount(), runningCount);
+    EXPECT_EQ(WorkStatus::GetUidRunningCount(uid), 0);
+    EXPECT_EQ(WorkStatus::GetBundleRunningCount(bundleName), 0);
+}
+}
 }
-}
\ No newline at end of file
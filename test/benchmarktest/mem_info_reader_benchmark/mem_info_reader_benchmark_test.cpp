@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <string>
+#include <benchmark/benchmark.h>
+
+#include "policy/mem_info_reader.h"
+
+using namespace OHOS::WorkScheduler;
+
+namespace {
+const int32_t BUF_LIMIT = 128;
+const int32_t INVALID_MEM = -1;
+
+/**
+ * The fopen + fgets + sscanf reader MemoryPolicy used before MemInfoReader, kept as the baseline.
+ */
+int32_t LegacyGetMemAvailable()
+{
+    int32_t memAvailable = INVALID_MEM;
+    FILE *fp = fopen("/proc/meminfo", "r");
+    if (fp == nullptr) {
+        return memAvailable;
+    }
+    char buf[BUF_LIMIT];
+    char name[BUF_LIMIT];
+    int32_t value = -1;
+    while (fgets(buf, BUF_LIMIT, fp) != nullptr) {
+        if (sscanf(buf, "%127s%d", name, &value) < 0) {
+            break;
+        }
+        std::string sname = name;
+        if (sname.find("MemAvailable") != std::string::npos) {
+            memAvailable = value;
+            break;
+        }
+    }
+    fclose(fp);
+    return memAvailable;
+}
+
+void BM_LegacyGetMemAvailable(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LegacyGetMemAvailable());
+    }
+}
+
+void BM_MemInfoReaderReadMemAvailable(benchmark::State &state)
+{
+    MemInfoReader reader;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.ReadMemAvailable());
+    }
+}
+
+void BM_MemInfoReaderReadMemPressure(benchmark::State &state)
+{
+    MemInfoReader reader;
+    if (reader.ReadMemPressure() < 0) {
+        state.SkipWithError("/proc/pressure/memory is not available");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.ReadMemPressure());
+    }
+}
+}
+
+BENCHMARK(BM_LegacyGetMemAvailable);
+BENCHMARK(BM_MemInfoReaderReadMemAvailable);
+BENCHMARK(BM_MemInfoReaderReadMemPressure);
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <list>
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "work_queue.h"
+#include "work_status.h"
+
+using namespace OHOS::WorkScheduler;
+
+namespace {
+const int32_t BENCHMARK_UID = 20008;
+const int32_t WORK_COUNT_SMALL = 100;
+const int32_t WORK_COUNT_MEDIUM = 1000;
+const int32_t WORK_COUNT_LARGE = 10000;
+
+std::vector<std::shared_ptr<WorkStatus>> CreateWorks(int32_t count)
+{
+    std::vector<std::shared_ptr<WorkStatus>> works;
+    works.reserve(count);
+    for (int32_t i = 0; i < count; i++) {
+        WorkInfo workInfo;
+        workInfo.SetWorkId(i);
+        workInfo.SetElement("com.example.benchmark", "benchmarkAbility");
+        auto workStatus = std::make_shared<WorkStatus>(workInfo, BENCHMARK_UID);
+        workStatus->MarkStatus(WorkStatus::Status::CONDITION_READY);
+        works.emplace_back(workStatus);
+    }
+    return works;
+}
+
+/**
+ * The list + sort selection WorkQueue used before the priority heap, kept as the baseline.
+ */
+std::shared_ptr<WorkStatus> LegacyGetWorkToRunByPriority(std::list<std::shared_ptr<WorkStatus>> &workList)
+{
+    workList.sort([](const std::shared_ptr<WorkStatus> &w1, const std::shared_ptr<WorkStatus> &w2) {
+        return w1->priority_ < w2->priority_;
+    });
+    for (auto &work : workList) {
+        if (work->GetStatus() == WorkStatus::CONDITION_READY) {
+            work->priority_++;
+            return work;
+        }
+    }
+    return nullptr;
+}
+
+void BM_LegacyListGetWorkToRunByPriority(benchmark::State &state)
+{
+    auto works = CreateWorks(static_cast<int32_t>(state.range(0)));
+    std::list<std::shared_ptr<WorkStatus>> workList(works.begin(), works.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LegacyGetWorkToRunByPriority(workList));
+    }
+}
+
+void BM_WorkQueueGetWorkToRunByPriority(benchmark::State &state)
+{
+    auto works = CreateWorks(static_cast<int32_t>(state.range(0)));
+    WorkQueue workQueue;
+    for (auto &work : works) {
+        workQueue.Push(work);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(workQueue.GetWorkToRunByPriority());
+    }
+}
+
+void BM_LegacyListPushAndSort(benchmark::State &state)
+{
+    auto works = CreateWorks(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        std::list<std::shared_ptr<WorkStatus>> workList;
+        for (auto &work : works) {
+            workList.push_back(work);
+        }
+        workList.sort([](const std::shared_ptr<WorkStatus> &w1, const std::shared_ptr<WorkStatus> &w2) {
+            return w1->priority_ < w2->priority_;
+        });
+        benchmark::DoNotOptimize(workList.front());
+    }
+}
+
+void BM_WorkQueuePush(benchmark::State &state)
+{
+    auto works = CreateWorks(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        WorkQueue workQueue;
+        for (auto &work : works) {
+            workQueue.Push(work);
+        }
+        benchmark::DoNotOptimize(workQueue.GetSize());
+    }
+}
+}
+
+BENCHMARK(BM_LegacyListGetWorkToRunByPriority)->Arg(WORK_COUNT_SMALL)->Arg(WORK_COUNT_MEDIUM)->Arg(WORK_COUNT_LARGE);
+BENCHMARK(BM_WorkQueueGetWorkToRunByPriority)->Arg(WORK_COUNT_SMALL)->Arg(WORK_COUNT_MEDIUM)->Arg(WORK_COUNT_LARGE);
+BENCHMARK(BM_LegacyListPushAndSort)->Arg(WORK_COUNT_SMALL)->Arg(WORK_COUNT_MEDIUM)->Arg(WORK_COUNT_LARGE);
+BENCHMARK(BM_WorkQueuePush)->Arg(WORK_COUNT_SMALL)->Arg(WORK_COUNT_MEDIUM)->Arg(WORK_COUNT_LARGE);
+BENCHMARK_MAIN();
@@ -21,6 +21,8 @@ namespace WorkScheduler {
 // services\native\src\work_policy_manager.cpp
 inline constexpr int32_t MAX_RUNNING_COUNT = 3;
 inline constexpr int32_t STANDBY_MAX_RUNNING_COUNT = 2 * MAX_RUNNING_COUNT;
+// the cost of one running slot of MAX_RUNNING_COUNT for the weighted policy.
+inline constexpr int32_t WORK_COST_UNIT = 100;
 inline constexpr uint32_t MAX_WORK_COUNT_PER_UID = 10;
 inline constexpr int32_t DELAY_TIME_LONG = 30000;
 inline constexpr int32_t DELAY_TIME_SHORT = 5000;
@@ -16,6 +16,7 @@
 #define FOUNDATION_RESOURCESCHEDULE_WORKSCHEDULER_WORK_SCHED_UTILS_H
 
 #include <string>
+#include <vector>
 
 namespace OHOS {
 namespace WorkScheduler {
@@ -37,6 +38,13 @@ public:
      * @return True if success,else false.
      */
     static bool IsIdActive(int32_t id);
+    /**
+     * @brief Get the ids of the active os accounts.
+     *
+     * @param ids The active account ids.
+     * @return True if success,else false.
+     */
+    static bool GetActiveAccountIds(std::vector<int32_t>& ids);
     /**
      * @brief Get user id by uid.
      *
@@ -86,6 +86,16 @@ bool WorkSchedUtils::IsIdActive(int32_t id)
     return false;
 }
 
+bool WorkSchedUtils::GetActiveAccountIds(std::vector<int32_t>& ids)
+{
+    ErrCode ret = AccountSA::OsAccountManager::QueryActiveOsAccountIds(ids);
+    if (ret != ERR_OK) {
+        WS_HILOGE("QueryActiveOsAccountIds failed.");
+        return false;
+    }
+    return true;
+}
+
 int32_t WorkSchedUtils::GetUserIdByUid(int32_t uid)
 {
     if (uid <= INVALID_DATA) {